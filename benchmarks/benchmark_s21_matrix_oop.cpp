@@ -0,0 +1,716 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdio>
+#include <sstream>
+
+#include "../s21_basic_matrix.h"
+#include "../s21_matrix_batch.h"
+#include "../s21_matrix_cholesky.h"
+#include "../s21_matrix_lu.h"
+#include "../s21_matrix_oop.h"
+#include "../s21_matrix_qr.h"
+#include "../s21_matrix_text.h"
+#include "../s21_sparse_matrix.h"
+
+S21Matrix make_matrix(int rows, int cols) {
+  S21Matrix m(rows, cols, S21Matrix::Uninitialized());
+  for (int i = 0; i != rows; ++i) {
+    for (int j = 0; j != cols; ++j) m(i, j) = std::sin(i * 0.37 + j * 0.11);
+    if (i < cols) m(i, i) += cols;
+  }
+  return m;
+}
+
+S21SparseMatrix make_sparse(int size, int per_row) {
+  S21SparseMatrix::Builder builder(size, size);
+  builder.Reserve(static_cast<long>(size) * per_row);
+  for (int i = 0; i != size; ++i) {
+    builder.Add(i, i, per_row);
+    for (int k = 1; k != per_row; ++k) {
+      builder.Add(i, (i * 7919L + k * 104729L) % size, std::sin(i + k));
+    }
+  }
+  return builder.Build();
+}
+
+void set_counters(benchmark::State& state, double flops, double bytes) {
+  if (flops > 0) {
+    state.counters["FLOPS"] = benchmark::Counter(
+        flops, benchmark::Counter::kIsIterationInvariantRate);
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(bytes * state.iterations()));
+}
+
+void shapes(benchmark::internal::Benchmark* b) {
+  for (int size = 2; size <= 4096; size *= 4) {
+    b->Args({size, size});
+    if (size >= 32) {
+      b->Args({size, size / 16});
+      b->Args({size / 16, size});
+    }
+  }
+  b->Args({4096, 4096});
+}
+
+void square(benchmark::internal::Benchmark* b, int max) {
+  for (int size = 2; size < max; size *= 4) b->Arg(size);
+  b->Arg(max);
+}
+
+void cubic_shapes(benchmark::internal::Benchmark* b) { square(b, 1024); }
+
+void gemm_shapes(benchmark::internal::Benchmark* b) { square(b, 4096); }
+
+void small_shapes(benchmark::internal::Benchmark* b) {
+  b->DenseRange(1, 2 * DET_CLOSED_FORM_MAX);
+}
+
+void BM_Construct(benchmark::State& state) {
+  int rows = state.range(0), cols = state.range(1);
+  for (auto _ : state) {
+    S21Matrix m(rows, cols);
+    benchmark::DoNotOptimize(m.Data());
+  }
+  set_counters(state, 0, 8.0 * rows * cols);
+}
+BENCHMARK(BM_Construct)->Apply(shapes);
+
+void BM_Copy(benchmark::State& state) {
+  S21Matrix m = make_matrix(state.range(0), state.range(1));
+  for (auto _ : state) {
+    S21Matrix copy(m);
+    benchmark::DoNotOptimize(copy.Data());
+  }
+  set_counters(state, 0, 16.0 * m.GetRows() * m.GetCols());
+}
+BENCHMARK(BM_Copy)->Apply(shapes);
+
+void BM_Move(benchmark::State& state) {
+  S21Matrix a = make_matrix(state.range(0), state.range(1)), b;
+  for (auto _ : state) {
+    b = std::move(a);
+    a = std::move(b);
+    benchmark::DoNotOptimize(a.Data());
+  }
+}
+BENCHMARK(BM_Move)->Apply(shapes);
+
+void BM_EqMatrix(benchmark::State& state) {
+  S21Matrix a = make_matrix(state.range(0), state.range(1)), b(a);
+  for (auto _ : state) benchmark::DoNotOptimize(a.EqMatrix(b));
+  double size = static_cast<double>(a.GetRows()) * a.GetCols();
+  set_counters(state, 0, 16 * size);
+}
+BENCHMARK(BM_EqMatrix)->Apply(shapes);
+
+void BM_SumMatrix(benchmark::State& state) {
+  S21Matrix a = make_matrix(state.range(0), state.range(1)), b(a);
+  for (auto _ : state) {
+    a.SumMatrix(b);
+    benchmark::ClobberMemory();
+  }
+  double size = static_cast<double>(a.GetRows()) * a.GetCols();
+  set_counters(state, size, 24 * size);
+}
+BENCHMARK(BM_SumMatrix)->Apply(shapes);
+
+void BM_SubMatrix(benchmark::State& state) {
+  S21Matrix a = make_matrix(state.range(0), state.range(1)), b(a);
+  for (auto _ : state) {
+    a.SubMatrix(b);
+    benchmark::ClobberMemory();
+  }
+  double size = static_cast<double>(a.GetRows()) * a.GetCols();
+  set_counters(state, size, 24 * size);
+}
+BENCHMARK(BM_SubMatrix)->Apply(shapes);
+
+void BM_MulNumber(benchmark::State& state) {
+  S21Matrix a = make_matrix(state.range(0), state.range(1));
+  for (auto _ : state) {
+    a.MulNumber(-1);
+    benchmark::ClobberMemory();
+  }
+  double size = static_cast<double>(a.GetRows()) * a.GetCols();
+  set_counters(state, size, 16 * size);
+}
+BENCHMARK(BM_MulNumber)->Apply(shapes);
+
+void BM_ExprSum(benchmark::State& state) {
+  S21Matrix a = make_matrix(state.range(0), state.range(1)), b(a), c(a);
+  for (auto _ : state) {
+    c = a + b;
+    benchmark::ClobberMemory();
+  }
+  double size = static_cast<double>(a.GetRows()) * a.GetCols();
+  set_counters(state, size, 24 * size);
+}
+BENCHMARK(BM_ExprSum)->Apply(shapes);
+
+void BM_ExprScale(benchmark::State& state) {
+  S21Matrix a = make_matrix(state.range(0), state.range(1)), c(a);
+  for (auto _ : state) {
+    c = a * -1.0;
+    benchmark::ClobberMemory();
+  }
+  double size = static_cast<double>(a.GetRows()) * a.GetCols();
+  set_counters(state, size, 16 * size);
+}
+BENCHMARK(BM_ExprScale)->Apply(shapes);
+
+void BM_MulMatrix(benchmark::State& state) {
+  int size = state.range(0);
+  S21Matrix a = make_matrix(size, size), b = make_matrix(size, size);
+  for (auto _ : state) {
+    S21Matrix c = a * b;
+    benchmark::DoNotOptimize(c.Data());
+  }
+  set_counters(state, 2.0 * size * size * size, 24.0 * size * size);
+}
+BENCHMARK(BM_MulMatrix)->Apply(gemm_shapes)->Unit(benchmark::kMillisecond);
+
+void BM_MulMatrixRectangular(benchmark::State& state) {
+  int rows = state.range(0), cols = state.range(1);
+  S21Matrix a = make_matrix(rows, cols), b = make_matrix(cols, rows);
+  for (auto _ : state) {
+    S21Matrix c = a * b;
+    benchmark::DoNotOptimize(c.Data());
+  }
+  set_counters(state, 2.0 * rows * cols * rows,
+               8.0 * (2.0 * rows * cols + 1.0 * rows * rows));
+}
+BENCHMARK(BM_MulMatrixRectangular)
+    ->Apply(shapes)
+    ->Unit(benchmark::kMillisecond);
+
+void BM_MulMatrixStrassen(benchmark::State& state) {
+  int size = state.range(0);
+  S21Matrix a = make_matrix(size, size), b = make_matrix(size, size);
+  for (auto _ : state) {
+    S21Matrix c(a);
+    c.MulMatrixStrassen(b);
+    benchmark::DoNotOptimize(c.Data());
+  }
+  set_counters(state, 2.0 * size * size * size, 24.0 * size * size);
+}
+BENCHMARK(BM_MulMatrixStrassen)
+    ->RangeMultiplier(2)
+    ->Range(512, 4096)
+    ->Unit(benchmark::kMillisecond);
+
+void BM_Transpose(benchmark::State& state) {
+  S21Matrix a = make_matrix(state.range(0), state.range(1));
+  for (auto _ : state) {
+    S21Matrix t = a.Transpose();
+    benchmark::DoNotOptimize(t.Data());
+  }
+  set_counters(state, 0, 16.0 * a.GetRows() * a.GetCols());
+}
+BENCHMARK(BM_Transpose)->Apply(shapes);
+
+void BM_TransposeInPlace(benchmark::State& state) {
+  S21Matrix a = make_matrix(state.range(0), state.range(1));
+  for (auto _ : state) {
+    a.TransposeInPlace();
+    benchmark::ClobberMemory();
+  }
+  set_counters(state, 0, 16.0 * a.GetRows() * a.GetCols());
+}
+BENCHMARK(BM_TransposeInPlace)->Apply(shapes);
+
+void BM_AppendRow(benchmark::State& state) {
+  int rows = state.range(0), cols = state.range(1);
+  S21Matrix row = make_matrix(1, cols);
+  for (auto _ : state) {
+    S21Matrix a;
+    a.Reserve(1, cols);
+    for (int i = 0; i != rows; ++i) a.AppendRow(row.Data());
+    benchmark::DoNotOptimize(a.Data());
+  }
+  set_counters(state, 0, 8.0 * rows * cols);
+}
+BENCHMARK(BM_AppendRow)->Args({4096, 64})->Args({65536, 16});
+
+void BM_SetRowsGrow(benchmark::State& state) {
+  int rows = state.range(0), cols = state.range(1);
+  for (auto _ : state) {
+    S21Matrix a(1, cols);
+    for (int i = 2; i <= rows; ++i) a.SetRows(i);
+    benchmark::DoNotOptimize(a.Data());
+  }
+  set_counters(state, 0, 8.0 * rows * cols);
+}
+BENCHMARK(BM_SetRowsGrow)->Args({4096, 64})->Args({65536, 16});
+
+void BM_SetColsGrow(benchmark::State& state) {
+  int rows = state.range(0), cols = state.range(1);
+  for (auto _ : state) {
+    S21Matrix a(rows, 1);
+    for (int j = 2; j <= cols; ++j) a.SetCols(j);
+    benchmark::DoNotOptimize(a.Data());
+  }
+  set_counters(state, 0, 8.0 * rows * cols);
+}
+BENCHMARK(BM_SetColsGrow)->Args({4096, 64})->Args({256, 256});
+
+void BM_Determinant(benchmark::State& state) {
+  int size = state.range(0);
+  S21Matrix a = make_matrix(size, size);
+  for (auto _ : state) benchmark::DoNotOptimize(a.Determinant());
+  set_counters(state, 2.0 / 3 * size * size * size, 16.0 * size * size);
+}
+BENCHMARK(BM_Determinant)->Apply(cubic_shapes)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Determinant)->Name("BM_DeterminantSmall")->Apply(small_shapes);
+
+void BM_CalcComplements(benchmark::State& state) {
+  int size = state.range(0);
+  S21Matrix a = make_matrix(size, size);
+  for (auto _ : state) {
+    S21Matrix c = a.CalcComplements();
+    benchmark::DoNotOptimize(c.Data());
+  }
+  set_counters(state, 8.0 / 3 * size * size * size, 24.0 * size * size);
+}
+BENCHMARK(BM_CalcComplements)
+    ->Apply(cubic_shapes)
+    ->Unit(benchmark::kMicrosecond);
+
+void BM_InverseMatrix(benchmark::State& state) {
+  int size = state.range(0);
+  S21Matrix a = make_matrix(size, size);
+  for (auto _ : state) {
+    S21Matrix c = a.InverseMatrix();
+    benchmark::DoNotOptimize(c.Data());
+  }
+  set_counters(state, 2.0 * size * size * size, 24.0 * size * size);
+}
+BENCHMARK(BM_InverseMatrix)
+    ->Apply(cubic_shapes)
+    ->Unit(benchmark::kMicrosecond);
+
+void BM_LuFactor(benchmark::State& state) {
+  int size = state.range(0);
+  S21Matrix a = make_matrix(size, size);
+  for (auto _ : state) {
+    S21MatrixLu lu = a.Lu();
+    benchmark::DoNotOptimize(lu.Packed().Data());
+  }
+  set_counters(state, 2.0 / 3 * size * size * size, 16.0 * size * size);
+}
+BENCHMARK(BM_LuFactor)->Apply(cubic_shapes)->Unit(benchmark::kMicrosecond);
+
+void BM_LuSolve(benchmark::State& state) {
+  int size = state.range(0), rhs = state.range(1);
+  S21Matrix a = make_matrix(size, size), b = make_matrix(size, rhs);
+  S21MatrixLu lu = a.Lu();
+  for (auto _ : state) {
+    S21Matrix x = lu.Solve(b);
+    benchmark::DoNotOptimize(x.Data());
+  }
+  set_counters(state, 2.0 * size * size * rhs, 16.0 * size * rhs);
+}
+BENCHMARK(BM_LuSolve)
+    ->Args({1024, 1})
+    ->Args({1024, 1024})
+    ->Unit(benchmark::kMicrosecond);
+
+void BM_LuSolveVector(benchmark::State& state) {
+  int size = state.range(0);
+  S21MatrixLu lu = make_matrix(size, size).Lu();
+  std::vector<double> b(size, 1);
+  for (auto _ : state) benchmark::DoNotOptimize(lu.Solve(b).data());
+  set_counters(state, 2.0 * size * size, 8.0 * size * size);
+}
+BENCHMARK(BM_LuSolveVector)->Arg(1024)->Unit(benchmark::kMicrosecond);
+
+void BM_InverseSolve(benchmark::State& state) {
+  int size = state.range(0), rhs = state.range(1);
+  S21Matrix a = make_matrix(size, size), b = make_matrix(size, rhs);
+  for (auto _ : state) {
+    S21Matrix x = a.InverseMatrix() * b;
+    benchmark::DoNotOptimize(x.Data());
+  }
+}
+BENCHMARK(BM_InverseSolve)
+    ->Args({1024, 1})
+    ->Args({1024, 1024})
+    ->Unit(benchmark::kMicrosecond);
+
+void BM_CholeskyFactor(benchmark::State& state) {
+  int size = state.range(0);
+  S21Matrix a = make_matrix(size, size);
+  for (auto _ : state) {
+    S21MatrixCholesky cholesky = a.Cholesky();
+    benchmark::DoNotOptimize(cholesky.L().Data());
+  }
+  set_counters(state, 1.0 / 3 * size * size * size, 16.0 * size * size);
+}
+BENCHMARK(BM_CholeskyFactor)
+    ->Apply(cubic_shapes)
+    ->Unit(benchmark::kMicrosecond);
+
+void BM_QrFactor(benchmark::State& state) {
+  int rows = state.range(0), cols = state.range(1);
+  S21Matrix a = make_matrix(rows, cols);
+  for (auto _ : state) {
+    S21MatrixQr qr = a.Qr();
+    benchmark::DoNotOptimize(qr.Packed().Data());
+  }
+  set_counters(state, 2.0 * cols * cols * (rows - cols / 3.0),
+               16.0 * rows * cols);
+}
+BENCHMARK(BM_QrFactor)
+    ->Args({256, 256})
+    ->Args({1024, 1024})
+    ->Args({4096, 256})
+    ->Unit(benchmark::kMicrosecond);
+
+void BM_QrSolve(benchmark::State& state) {
+  int rows = state.range(0), cols = state.range(1);
+  S21Matrix a = make_matrix(rows, cols), b = make_matrix(rows, 16);
+  S21MatrixQr qr = a.Qr();
+  for (auto _ : state) {
+    S21Matrix x = qr.Solve(b);
+    benchmark::DoNotOptimize(x.Data());
+  }
+}
+BENCHMARK(BM_QrSolve)->Args({4096, 256})->Unit(benchmark::kMicrosecond);
+
+void BM_Gemm(benchmark::State& state) {
+  int size = state.range(0);
+  S21Matrix a = make_matrix(size, size), b = make_matrix(size, size);
+  S21Matrix c = make_matrix(size, size);
+  for (auto _ : state) {
+    S21Matrix::Gemm(0.5, a, true, b, false, 1, c);
+    benchmark::DoNotOptimize(c.Data());
+  }
+  set_counters(state, 2.0 * size * size * size, 24.0 * size * size);
+}
+BENCHMARK(BM_Gemm)->Apply(cubic_shapes)->Unit(benchmark::kMicrosecond);
+
+void BM_GemmUnfused(benchmark::State& state) {
+  int size = state.range(0);
+  S21Matrix a = make_matrix(size, size), b = make_matrix(size, size);
+  S21Matrix c = make_matrix(size, size);
+  for (auto _ : state) {
+    c += a.Transpose() * b * 0.5;
+    benchmark::DoNotOptimize(c.Data());
+  }
+  set_counters(state, 2.0 * size * size * size, 24.0 * size * size);
+}
+BENCHMARK(BM_GemmUnfused)
+    ->Apply(cubic_shapes)
+    ->Unit(benchmark::kMicrosecond);
+
+void BM_Gemv(benchmark::State& state) {
+  int size = state.range(0);
+  S21Matrix a = make_matrix(size, size);
+  std::vector<double> x(size, 1), y(size, 1);
+  for (auto _ : state) {
+    S21Matrix::Gemv(0.5, a, state.range(1), x, 1, y);
+    benchmark::DoNotOptimize(y.data());
+  }
+  set_counters(state, 2.0 * size * size, 8.0 * size * size);
+}
+BENCHMARK(BM_Gemv)->Args({4096, 0})->Args({4096, 1});
+
+void BM_StreamOut(benchmark::State& state) {
+  S21Matrix a = make_matrix(state.range(0), state.range(1));
+  double bytes = 0;
+  for (auto _ : state) {
+    std::ostringstream out;
+    out << a;
+    bytes += out.tellp();
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(bytes));
+}
+BENCHMARK(BM_StreamOut)->Apply(shapes)->Unit(benchmark::kMicrosecond);
+
+void BM_StreamIn(benchmark::State& state) {
+  S21Matrix a = make_matrix(state.range(0), state.range(1));
+  std::ostringstream out;
+  out << a;
+  std::string text = out.str();
+  for (auto _ : state) {
+    std::istringstream in(text);
+    in >> a;
+    benchmark::ClobberMemory();
+  }
+  set_counters(state, 0, static_cast<double>(text.size()));
+}
+BENCHMARK(BM_StreamIn)->Apply(shapes)->Unit(benchmark::kMicrosecond);
+
+void BM_TextWrite(benchmark::State& state) {
+  S21Matrix a = make_matrix(state.range(0), state.range(1));
+  double bytes = 0;
+  for (auto _ : state) {
+    std::ostringstream out;
+    S21MatrixWriter(out, S21_TEXT_CSV).WriteMatrix(a);
+    bytes += out.tellp();
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(bytes));
+}
+BENCHMARK(BM_TextWrite)->Apply(shapes)->Unit(benchmark::kMicrosecond);
+
+void BM_TextRead(benchmark::State& state) {
+  S21Matrix a = make_matrix(state.range(0), state.range(1));
+  std::ostringstream out;
+  S21MatrixWriter(out, S21_TEXT_CSV).WriteMatrix(a);
+  std::string text = out.str();
+  for (auto _ : state) {
+    std::istringstream in(text);
+    S21Matrix res = S21MatrixReader(in, S21_TEXT_CSV).ReadMatrix();
+    benchmark::DoNotOptimize(res.Data());
+  }
+  set_counters(state, 0, static_cast<double>(text.size()));
+}
+BENCHMARK(BM_TextRead)->Apply(shapes)->Unit(benchmark::kMicrosecond);
+
+void BM_Save(benchmark::State& state) {
+  S21Matrix a = make_matrix(state.range(0), state.range(1));
+  for (auto _ : state) a.Save("s21_benchmark_matrix.bin");
+  set_counters(state, 0, 8.0 * a.GetRows() * a.GetCols());
+  std::remove("s21_benchmark_matrix.bin");
+}
+BENCHMARK(BM_Save)->Apply(shapes)->Unit(benchmark::kMicrosecond);
+
+void BM_Load(benchmark::State& state) {
+  S21Matrix a = make_matrix(state.range(0), state.range(1));
+  a.Save("s21_benchmark_matrix.bin");
+  for (auto _ : state) {
+    S21Matrix loaded = S21Matrix::Load("s21_benchmark_matrix.bin");
+    benchmark::DoNotOptimize(loaded.Data());
+  }
+  set_counters(state, 0, 8.0 * a.GetRows() * a.GetCols());
+  std::remove("s21_benchmark_matrix.bin");
+}
+BENCHMARK(BM_Load)->Apply(shapes)->Unit(benchmark::kMicrosecond);
+
+void BM_Map(benchmark::State& state) {
+  S21Matrix a = make_matrix(state.range(0), state.range(1));
+  a.Save("s21_benchmark_matrix.bin");
+  for (auto _ : state) {
+    S21Matrix mapped = S21Matrix::Map("s21_benchmark_matrix.bin");
+    benchmark::DoNotOptimize(mapped.Data());
+  }
+  std::remove("s21_benchmark_matrix.bin");
+}
+BENCHMARK(BM_Map)->Apply(shapes)->Unit(benchmark::kMicrosecond);
+
+void sparse_shapes(benchmark::internal::Benchmark* b) {
+  for (int size = 256; size <= 4096; size *= 4) b->Args({size, 8});
+}
+
+void BM_SparseMatVec(benchmark::State& state) {
+  int size = state.range(0);
+  S21SparseMatrix a = make_sparse(size, state.range(1));
+  std::vector<double> x(size, 1.0);
+  for (auto _ : state) {
+    std::vector<double> y = a * x;
+    benchmark::DoNotOptimize(y.data());
+  }
+  set_counters(state, 2.0 * a.GetNonZeros(), 12.0 * a.GetNonZeros());
+}
+BENCHMARK(BM_SparseMatVec)
+    ->Apply(sparse_shapes)
+    ->Args({65536, 8})
+    ->Unit(benchmark::kMicrosecond);
+
+void BM_DenseMatVec(benchmark::State& state) {
+  int size = state.range(0);
+  S21Matrix a = make_sparse(size, state.range(1)).ToDense();
+  S21Matrix x = make_matrix(size, 1);
+  for (auto _ : state) {
+    S21Matrix y = a * x;
+    benchmark::DoNotOptimize(y.Data());
+  }
+  set_counters(state, 2.0 * size * size, 8.0 * size * size);
+}
+BENCHMARK(BM_DenseMatVec)
+    ->Apply(sparse_shapes)
+    ->Unit(benchmark::kMicrosecond);
+
+void BM_SparseMulDense(benchmark::State& state) {
+  int size = state.range(0);
+  S21SparseMatrix a = make_sparse(size, state.range(1));
+  S21Matrix b = make_matrix(size, 64);
+  for (auto _ : state) {
+    S21Matrix c = a * b;
+    benchmark::DoNotOptimize(c.Data());
+  }
+  set_counters(state, 128.0 * a.GetNonZeros(), 8.0 * 128 * size);
+}
+BENCHMARK(BM_SparseMulDense)
+    ->Apply(sparse_shapes)
+    ->Unit(benchmark::kMicrosecond);
+
+void BM_DenseMulDense(benchmark::State& state) {
+  int size = state.range(0);
+  S21Matrix a = make_sparse(size, state.range(1)).ToDense();
+  S21Matrix b = make_matrix(size, 64);
+  for (auto _ : state) {
+    S21Matrix c = a * b;
+    benchmark::DoNotOptimize(c.Data());
+  }
+  set_counters(state, 128.0 * size * size, 8.0 * size * size);
+}
+BENCHMARK(BM_DenseMulDense)
+    ->Apply(sparse_shapes)
+    ->Unit(benchmark::kMicrosecond);
+
+void BM_SparseSum(benchmark::State& state) {
+  int size = state.range(0);
+  S21SparseMatrix a = make_sparse(size, state.range(1));
+  S21SparseMatrix b = a.Transpose();
+  for (auto _ : state) {
+    S21SparseMatrix c = a + b;
+    benchmark::DoNotOptimize(c.Values());
+  }
+  set_counters(state, 0, 24.0 * a.GetNonZeros());
+}
+BENCHMARK(BM_SparseSum)->Apply(sparse_shapes)->Unit(benchmark::kMicrosecond);
+
+void BM_SparseTranspose(benchmark::State& state) {
+  S21SparseMatrix a = make_sparse(state.range(0), state.range(1));
+  for (auto _ : state) {
+    S21SparseMatrix c = a.Transpose();
+    benchmark::DoNotOptimize(c.Values());
+  }
+  set_counters(state, 0, 24.0 * a.GetNonZeros());
+}
+BENCHMARK(BM_SparseTranspose)
+    ->Apply(sparse_shapes)
+    ->Unit(benchmark::kMicrosecond);
+
+S21MatrixBatch make_batch(int count, int size) {
+  S21MatrixBatch batch(count, size, size);
+  for (int i = 0; i != size; ++i) {
+    for (int j = 0; j != size; ++j) {
+      double* lane = batch.Lane(i, j);
+      for (int l = 0; l != count; ++l) {
+        lane[l] = std::sin(l * 0.37 + i * 1.3 + j * 0.11) + (i == j) * size;
+      }
+    }
+  }
+  return batch;
+}
+
+void batch_shapes(benchmark::internal::Benchmark* b) {
+  for (int size = 2; size <= 4; ++size) b->Args({1 << 20, size});
+}
+
+void BM_BatchDeterminant(benchmark::State& state) {
+  S21MatrixBatch batch = make_batch(state.range(0), state.range(1));
+  for (auto _ : state) {
+    std::vector<double> det = batch.Determinant();
+    benchmark::DoNotOptimize(det.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BatchDeterminant)
+    ->Apply(batch_shapes)
+    ->Unit(benchmark::kMillisecond);
+
+void BM_LoopDeterminant(benchmark::State& state) {
+  S21MatrixBatch batch = make_batch(state.range(0), state.range(1));
+  std::vector<S21Matrix> matrices;
+  for (int l = 0; l != batch.GetCount(); ++l) matrices.push_back(batch.Get(l));
+  for (auto _ : state) {
+    for (const S21Matrix& m : matrices) {
+      benchmark::DoNotOptimize(m.Determinant());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LoopDeterminant)
+    ->Apply(batch_shapes)
+    ->Unit(benchmark::kMillisecond);
+
+void BM_BatchInverse(benchmark::State& state) {
+  S21MatrixBatch batch = make_batch(state.range(0), state.range(1));
+  for (auto _ : state) {
+    S21MatrixBatch inverse = batch.InverseMatrix();
+    benchmark::DoNotOptimize(inverse.Lane(0, 0));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BatchInverse)
+    ->Apply(batch_shapes)
+    ->Unit(benchmark::kMillisecond);
+
+void BM_LoopInverse(benchmark::State& state) {
+  S21MatrixBatch batch = make_batch(state.range(0), state.range(1));
+  std::vector<S21Matrix> matrices;
+  for (int l = 0; l != batch.GetCount(); ++l) matrices.push_back(batch.Get(l));
+  for (auto _ : state) {
+    for (const S21Matrix& m : matrices) {
+      S21Matrix inverse = m.InverseMatrix();
+      benchmark::DoNotOptimize(inverse.Data());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LoopInverse)->Apply(batch_shapes)->Unit(benchmark::kMillisecond);
+
+void BM_BatchMulMatrix(benchmark::State& state) {
+  S21MatrixBatch a = make_batch(state.range(0), state.range(1));
+  S21MatrixBatch b = a.Transpose();
+  for (auto _ : state) {
+    S21MatrixBatch c = a * b;
+    benchmark::DoNotOptimize(c.Lane(0, 0));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BatchMulMatrix)
+    ->Apply(batch_shapes)
+    ->Unit(benchmark::kMillisecond);
+
+void BM_FloatSumMatrix(benchmark::State& state) {
+  S21MatrixFloat a(make_matrix(state.range(0), state.range(1))), b(a);
+  for (auto _ : state) {
+    a.SumMatrix(b);
+    benchmark::ClobberMemory();
+  }
+  double size = static_cast<double>(a.GetRows()) * a.GetCols();
+  set_counters(state, size, 12 * size);
+}
+BENCHMARK(BM_FloatSumMatrix)->Apply(shapes);
+
+void BM_FloatMulMatrix(benchmark::State& state) {
+  int size = state.range(0);
+  S21MatrixFloat a(make_matrix(size, size)), b(a);
+  for (auto _ : state) {
+    S21MatrixFloat c = a * b;
+    benchmark::DoNotOptimize(c.Data());
+  }
+  set_counters(state, 2.0 * size * size * size, 12.0 * size * size);
+}
+BENCHMARK(BM_FloatMulMatrix)
+    ->Apply(cubic_shapes)
+    ->Unit(benchmark::kMillisecond);
+
+void BM_Int64Determinant(benchmark::State& state) {
+  int size = state.range(0);
+  S21MatrixInt64 a(size, size);
+  for (int i = 0; i != size; ++i) a(i, i) = 1;
+  for (int i = 1; i != size; ++i) a(i, i - 1) = 1;
+  for (auto _ : state) benchmark::DoNotOptimize(a.Determinant());
+  set_counters(state, 2.0 * size * size * size / 3, 8.0 * size * size);
+}
+BENCHMARK(BM_Int64Determinant)->RangeMultiplier(4)->Range(4, 256);
+
+void BM_ComplexMulMatrix(benchmark::State& state) {
+  int size = state.range(0);
+  S21MatrixComplex a(make_matrix(size, size)), b(a);
+  for (auto _ : state) {
+    S21MatrixComplex c = a * b;
+    benchmark::DoNotOptimize(c.Data());
+  }
+  set_counters(state, 8.0 * size * size * size, 48.0 * size * size);
+}
+BENCHMARK(BM_ComplexMulMatrix)
+    ->Apply(cubic_shapes)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <complex>
+#include <cstdint>
+#include <limits>
+
+#include "s21_matrix_oop.h"
+
+template <>
+struct S21MatrixTraits<float> {
+  using Real = float;
+  static constexpr bool exact = false;
+  static constexpr Real tolerance = 1e-4f;
+
+  static void Add(float* a, const float* b, long size) noexcept {
+    simd_kernels().add_float(a, b, size);
+  }
+  static void Sub(float* a, const float* b, long size) noexcept {
+    simd_kernels().sub_float(a, b, size);
+  }
+  static void MulNumber(float* a, long size, float number) noexcept {
+    simd_kernels().mul_number_float(a, size, number, tolerance);
+  }
+  static bool Equal(const float* a, const float* b, long size) noexcept {
+    return simd_kernels().equal_float(a, b, size, tolerance);
+  }
+  static float Flush(float value) noexcept {
+    return std::fabs(value) < tolerance ? 0 : value;
+  }
+};
+
+// Span operations for the element types without SIMD kernels; Traits
+// provides Flush and Near for single values.
+template <typename T, typename Traits>
+struct S21MatrixLoops {
+  static void Add(T* a, const T* b, long size) noexcept {
+    for (long i = 0; i != size; ++i) a[i] += b[i];
+  }
+  static void Sub(T* a, const T* b, long size) noexcept {
+    for (long i = 0; i != size; ++i) a[i] -= b[i];
+  }
+  static void MulNumber(T* a, long size, T number) noexcept {
+    for (long i = 0; i != size; ++i) a[i] = Traits::Flush(a[i] * number);
+  }
+  static bool Equal(const T* a, const T* b, long size) noexcept {
+    for (long i = 0; i != size; ++i) {
+      if (!Traits::Near(a[i], b[i])) return false;
+    }
+    return true;
+  }
+};
+
+template <>
+struct S21MatrixTraits<int64_t>
+    : S21MatrixLoops<int64_t, S21MatrixTraits<int64_t>> {
+  using Real = int64_t;
+  static constexpr bool exact = true;
+  static constexpr Real tolerance = 0;
+
+  static int64_t Flush(int64_t value) noexcept { return value; }
+  static bool Near(int64_t a, int64_t b) noexcept { return a == b; }
+};
+
+template <>
+struct S21MatrixTraits<std::complex<double>>
+    : S21MatrixLoops<std::complex<double>,
+                     S21MatrixTraits<std::complex<double>>> {
+  using Real = double;
+  static constexpr bool exact = false;
+  static constexpr Real tolerance = PRECISION;
+
+  static std::complex<double> Flush(std::complex<double> value) noexcept {
+    return std::abs(value) < tolerance ? std::complex<double>() : value;
+  }
+  static bool Near(std::complex<double> a, std::complex<double> b) noexcept {
+    return std::abs(a - b) <= tolerance;
+  }
+};
+
+// BasicMatrix is instantiated for double (S21Matrix), float, int64_t and
+// std::complex<double>. int64_t uses fraction-free Bareiss elimination for
+// Determinant, CalcComplements and InverseMatrix; it throws
+// std::overflow_error on overflow and std::logic_error when the inverse isn't
+// an integer matrix. Lu, Cholesky and Qr are only provided for double.
+extern template class BasicMatrix<float>;
+extern template class BasicMatrix<int64_t>;
+extern template class BasicMatrix<std::complex<double>>;
+extern template class BasicMatrixView<float>;
+extern template class BasicMatrixView<int64_t>;
+extern template class BasicMatrixView<std::complex<double>>;
+
+using S21MatrixFloat = BasicMatrix<float>;
+using S21MatrixInt64 = BasicMatrix<int64_t>;
+using S21MatrixComplex = BasicMatrix<std::complex<double>>;
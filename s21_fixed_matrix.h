@@ -0,0 +1,305 @@
+#pragma once
+
+#include <cfloat>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_matrix_oop.h"
+
+template <int R, int C>
+class S21FixedMatrix {
+  static_assert(R > 0 && C > 0, "Sizes of rows or cols must be greater than 0");
+
+ public:
+  constexpr S21FixedMatrix() noexcept : matrix_{} {}
+
+  constexpr S21FixedMatrix(std::initializer_list<double> values) : matrix_{} {
+    if (values.size() != static_cast<std::size_t>(R * C))
+      throw std::invalid_argument("The number of values doesn't match sizes");
+
+    int i = 0;
+    for (double value : values) matrix_[i++] = value;
+  }
+
+  explicit S21FixedMatrix(const S21Matrix& o) : matrix_{} {
+    if (o.GetRows() != R || o.GetCols() != C)
+      throw std::logic_error("Matrices have different size of parametrs");
+
+    std::copy(o.Data(), o.Data() + R * C, matrix_);
+  }
+
+  explicit operator S21Matrix() const {
+    S21Matrix res(R, C, S21Matrix::Uninitialized());
+    std::copy(matrix_, matrix_ + R * C, res.Data());
+    return res;
+  }
+
+  constexpr double& operator()(int row, int col) {
+#ifndef S21_MATRIX_NO_BOUNDS_CHECK
+    if (row >= R || col >= C || row < 0 || col < 0)
+      throw std::out_of_range("Incorrect parametrs of Matrix");
+#endif
+
+    return matrix_[row * C + col];
+  }
+
+  constexpr const double& operator()(int row, int col) const {
+#ifndef S21_MATRIX_NO_BOUNDS_CHECK
+    if (row >= R || col >= C || row < 0 || col < 0)
+      throw std::out_of_range("Incorrect parametrs of Matrix");
+#endif
+
+    return matrix_[row * C + col];
+  }
+
+  constexpr double* Data() noexcept { return matrix_; }
+  constexpr const double* Data() const noexcept { return matrix_; }
+  constexpr int GetRows() const noexcept { return R; }
+  constexpr int GetCols() const noexcept { return C; }
+
+  constexpr bool EqMatrix(const S21FixedMatrix& o) const noexcept {
+    for (int i = 0; i != R * C; ++i) {
+      if (Abs(matrix_[i] - o.matrix_[i]) > PRECISION) return false;
+    }
+    return true;
+  }
+
+  constexpr bool operator==(const S21FixedMatrix& o) const noexcept {
+    return EqMatrix(o);
+  }
+
+  constexpr S21FixedMatrix& operator+=(const S21FixedMatrix& o) noexcept {
+    for (int i = 0; i != R * C; ++i) matrix_[i] += o.matrix_[i];
+    return *this;
+  }
+
+  constexpr S21FixedMatrix& operator-=(const S21FixedMatrix& o) noexcept {
+    for (int i = 0; i != R * C; ++i) matrix_[i] -= o.matrix_[i];
+    return *this;
+  }
+
+  constexpr S21FixedMatrix& operator*=(double o) noexcept {
+    for (int i = 0; i != R * C; ++i) matrix_[i] = Flush(matrix_[i] * o);
+    return *this;
+  }
+
+  constexpr S21FixedMatrix operator+(const S21FixedMatrix& o) const noexcept {
+    S21FixedMatrix res(*this);
+    return res += o;
+  }
+
+  constexpr S21FixedMatrix operator-(const S21FixedMatrix& o) const noexcept {
+    S21FixedMatrix res(*this);
+    return res -= o;
+  }
+
+  constexpr S21FixedMatrix operator*(double o) const noexcept {
+    S21FixedMatrix res(*this);
+    return res *= o;
+  }
+
+  friend constexpr S21FixedMatrix operator*(double o1,
+                                            const S21FixedMatrix& o2) noexcept {
+    return o2 * o1;
+  }
+
+  template <int K>
+  constexpr S21FixedMatrix<R, K> operator*(
+      const S21FixedMatrix<C, K>& o) const noexcept {
+    return Multiply(o, std::make_index_sequence<R * K>());
+  }
+
+  constexpr S21FixedMatrix<C, R> Transpose() const noexcept {
+    S21FixedMatrix<C, R> res;
+    for (int i = 0; i != R; ++i) {
+      for (int j = 0; j != C; ++j) res.matrix_[j * R + i] = matrix_[i * C + j];
+    }
+    return res;
+  }
+
+  constexpr double Determinant() const noexcept {
+    static_assert(R == C, "The matrix isn't squared");
+
+    const double* a = matrix_;
+    if constexpr (R == 1) {
+      return a[0];
+    } else if constexpr (R == 2) {
+      return a[0] * a[3] - a[1] * a[2];
+    } else if constexpr (R == 3) {
+      return a[0] * (a[4] * a[8] - a[5] * a[7]) -
+             a[1] * (a[3] * a[8] - a[5] * a[6]) +
+             a[2] * (a[3] * a[7] - a[4] * a[6]);
+    } else if constexpr (R == 4) {
+      double s0 = a[0] * a[5] - a[1] * a[4];
+      double s1 = a[0] * a[6] - a[2] * a[4];
+      double s2 = a[0] * a[7] - a[3] * a[4];
+      double s3 = a[1] * a[6] - a[2] * a[5];
+      double s4 = a[1] * a[7] - a[3] * a[5];
+      double s5 = a[2] * a[7] - a[3] * a[6];
+
+      double c5 = a[10] * a[15] - a[11] * a[14];
+      double c4 = a[9] * a[15] - a[11] * a[13];
+      double c3 = a[9] * a[14] - a[10] * a[13];
+      double c2 = a[8] * a[15] - a[11] * a[12];
+      double c1 = a[8] * a[14] - a[10] * a[12];
+      double c0 = a[8] * a[13] - a[9] * a[12];
+
+      return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+    } else {
+      S21FixedMatrix lu(*this);
+      double res = 1;
+
+      for (int k = 0; k != R; ++k) {
+        int pivot_row = k;
+        for (int i = k + 1; i != R; ++i) {
+          if (Abs(lu.matrix_[i * R + k]) > Abs(lu.matrix_[pivot_row * R + k]))
+            pivot_row = i;
+        }
+        if (lu.matrix_[pivot_row * R + k] == 0) return 0;
+
+        if (pivot_row != k) {
+          for (int j = 0; j != R; ++j) {
+            Swap(lu.matrix_[k * R + j], lu.matrix_[pivot_row * R + j]);
+          }
+          res = -res;
+        }
+
+        res *= lu.matrix_[k * R + k];
+        for (int i = k + 1; i != R; ++i) {
+          double factor = lu.matrix_[i * R + k] / lu.matrix_[k * R + k];
+          for (int j = k + 1; j != R; ++j) {
+            lu.matrix_[i * R + j] -= factor * lu.matrix_[k * R + j];
+          }
+        }
+      }
+      return res;
+    }
+  }
+
+  constexpr S21FixedMatrix CalcComplements() const noexcept {
+    static_assert(R == C, "The matrix isn't squared");
+
+    S21FixedMatrix res;
+    if constexpr (R == 1) {
+      res.matrix_[0] = 1;
+    } else {
+      for (int i = 0; i != R; ++i) {
+        for (int j = 0; j != C; ++j) {
+          double minor = Minor(i, j).Determinant();
+          res.matrix_[i * C + j] = (i + j) % 2 ? -minor : minor;
+        }
+      }
+    }
+    return res;
+  }
+
+  constexpr S21FixedMatrix InverseMatrix() const {
+    static_assert(R == C, "The matrix isn't squared");
+
+    double det = Determinant();
+    double bound = 1;
+    for (int i = 0; i != R; ++i) {
+      double norm = 0;
+      for (int j = 0; j != C; ++j) norm += Abs(matrix_[i * C + j]);
+      bound *= norm;
+    }
+
+    if (Abs(det) <= R * DBL_EPSILON * bound) {
+      throw std::logic_error(
+          "The matrix is singular, the inverse matrix isn't exists");
+    }
+
+    S21FixedMatrix res = CalcComplements().Transpose();
+    for (int i = 0; i != R * C; ++i) res.matrix_[i] /= det;
+    return res;
+  }
+
+ private:
+  template <int, int>
+  friend class S21FixedMatrix;
+
+  static constexpr double Abs(double x) noexcept { return x < 0 ? -x : x; }
+
+  static constexpr double Flush(double x) noexcept {
+    return Abs(x) < PRECISION ? 0 : x;
+  }
+
+  static constexpr void Swap(double& a, double& b) noexcept {
+    double temp = a;
+    a = b;
+    b = temp;
+  }
+
+  template <int K, std::size_t... I>
+  constexpr S21FixedMatrix<R, K> Multiply(
+      const S21FixedMatrix<C, K>& o,
+      std::index_sequence<I...>) const noexcept {
+    S21FixedMatrix<R, K> res;
+    ((res.matrix_[I] =
+          Flush(Dot(o, I / K, I % K, std::make_index_sequence<C>()))),
+     ...);
+    return res;
+  }
+
+  template <int K, std::size_t... P>
+  constexpr double Dot(const S21FixedMatrix<C, K>& o, int row, int col,
+                       std::index_sequence<P...>) const noexcept {
+    return ((matrix_[row * C + P] * o.matrix_[P * K + col]) + ...);
+  }
+
+  constexpr S21FixedMatrix<R - 1, C - 1> Minor(int skip_row,
+                                               int skip_col) const noexcept {
+    S21FixedMatrix<R - 1, C - 1> res;
+    for (int i = 0, row = 0; i != R; ++i) {
+      if (i == skip_row) continue;
+      for (int j = 0, col = 0; j != C; ++j) {
+        if (j == skip_col) continue;
+        res.matrix_[row * (C - 1) + col++] = matrix_[i * C + j];
+      }
+      ++row;
+    }
+    return res;
+  }
+
+  double matrix_[R * C];
+};
+
+template <int R, int C>
+S21Matrix operator+(const S21Matrix& l, const S21FixedMatrix<R, C>& r) {
+  return r + l;
+}
+
+template <int R, int C>
+S21Matrix operator+(const S21FixedMatrix<R, C>& l, const S21Matrix& r) {
+  S21Matrix res(static_cast<S21Matrix>(l));
+  res.SumMatrix(r);
+  return res;
+}
+
+template <int R, int C>
+S21Matrix operator-(const S21Matrix& l, const S21FixedMatrix<R, C>& r) {
+  if (l.GetRows() != R || l.GetCols() != C)
+    throw std::logic_error("Matrices have different size of parametrs");
+
+  S21Matrix res(l);
+  for (int i = 0; i != R * C; ++i) res.Data()[i] -= r.Data()[i];
+  return res;
+}
+
+template <int R, int C>
+S21Matrix operator-(const S21FixedMatrix<R, C>& l, const S21Matrix& r) {
+  S21Matrix res(static_cast<S21Matrix>(l));
+  res.SubMatrix(r);
+  return res;
+}
+
+template <int R, int C>
+S21Matrix operator*(const S21Matrix& l, const S21FixedMatrix<R, C>& r) {
+  return l * static_cast<S21Matrix>(r);
+}
+
+template <int R, int C>
+S21Matrix operator*(const S21FixedMatrix<R, C>& l, const S21Matrix& r) {
+  return static_cast<S21Matrix>(l) * r;
+}
@@ -0,0 +1,183 @@
+#include <atomic>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <new>
+
+#include "s21_basic_matrix.h"
+#include "s21_matrix_stats.h"
+
+#define POOL_MIN_CLASS 3
+#define POOL_MAX_CLASS 20
+#define POOL_CLASS_DEPTH 8
+#define POOL_MAX_CACHED (32L << 20)
+
+thread_local bool s21_pool_destroyed = false;
+
+struct S21BufferPool {
+  double* buffers[POOL_MAX_CLASS + 1][POOL_CLASS_DEPTH] = {};
+  int counts[POOL_MAX_CLASS + 1] = {};
+  long cached = 0;
+
+  ~S21BufferPool() {
+    for (int c = POOL_MIN_CLASS; c <= POOL_MAX_CLASS; ++c) {
+      for (int i = 0; i != counts[c]; ++i) {
+        ::operator delete(buffers[c][i],
+                          std::align_val_t(S21_MATRIX_ALIGNMENT));
+      }
+    }
+    s21_pool_destroyed = true;
+  }
+};
+
+S21BufferPool& local_pool() {
+  thread_local S21BufferPool pool;
+  return pool;
+}
+
+int pool_class(long size) {
+  int res = POOL_MIN_CLASS;
+  while (res <= POOL_MAX_CLASS && (1L << res) < size) ++res;
+  return res;
+}
+
+double* aligned_allocate(long size) {
+  return static_cast<double*>(::operator new(
+      size * sizeof(double), std::align_val_t(S21_MATRIX_ALIGNMENT)));
+}
+
+double* pool_allocate(long size) {
+  if (size == 0) return nullptr;
+
+  int c = pool_class(size);
+  if (c > POOL_MAX_CLASS) return aligned_allocate(size);
+
+  if (!s21_pool_destroyed) {
+    S21BufferPool& pool = local_pool();
+    if (pool.counts[c] != 0) {
+      pool.cached -= (1L << c) * sizeof(double);
+      return pool.buffers[c][--pool.counts[c]];
+    }
+  }
+  return aligned_allocate(1L << c);
+}
+
+void pool_deallocate(double* ptr, long size) {
+  if (ptr == nullptr) return;
+
+  int c = pool_class(size);
+  long bytes = (1L << c) * sizeof(double);
+
+  if (c <= POOL_MAX_CLASS && !s21_pool_destroyed) {
+    S21BufferPool& pool = local_pool();
+    if (pool.counts[c] != POOL_CLASS_DEPTH &&
+        pool.cached + bytes <= POOL_MAX_CACHED) {
+      pool.buffers[c][pool.counts[c]++] = ptr;
+      pool.cached += bytes;
+      return;
+    }
+  }
+  ::operator delete(ptr, std::align_val_t(S21_MATRIX_ALIGNMENT));
+}
+
+const S21MatrixAllocator s21_default_allocator = {pool_allocate,
+                                                  pool_deallocate};
+
+std::atomic<const S21MatrixAllocator*> s21_allocator(&s21_default_allocator);
+
+// Live matrices keep a pointer to the allocator that owns their buffer, so
+// installed allocators outlive every matrix; each distinct pair is stored once.
+const S21MatrixAllocator* intern_allocator(
+    const S21MatrixAllocator& allocator) {
+  static std::mutex mutex;
+  static std::deque<S21MatrixAllocator>& allocators =
+      *new std::deque<S21MatrixAllocator>;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  for (const S21MatrixAllocator& known : allocators) {
+    if (known.allocate == allocator.allocate &&
+        known.deallocate == allocator.deallocate)
+      return &known;
+  }
+  allocators.push_back(allocator);
+  return &allocators.back();
+}
+
+S21MatrixAllocator S21MatrixBase::DefaultAllocator() noexcept {
+  return s21_default_allocator;
+}
+
+S21MatrixAllocator S21MatrixBase::GetAllocator() noexcept {
+  return *s21_allocator;
+}
+
+void S21MatrixBase::SetAllocator(const S21MatrixAllocator& allocator) {
+  if (allocator.allocate == nullptr || allocator.deallocate == nullptr)
+    throw std::invalid_argument("The allocator must provide both functions");
+
+  if (allocator.allocate == s21_default_allocator.allocate &&
+      allocator.deallocate == s21_default_allocator.deallocate) {
+    s21_allocator = &s21_default_allocator;
+  } else {
+    s21_allocator = intern_allocator(allocator);
+  }
+}
+
+template <typename T>
+void BasicMatrix<T>::Allocate(int rows, int cols) {
+  const S21MatrixAllocator* allocator = s21_allocator;
+  long size = s21_allocator_size<T>(static_cast<long>(rows) * cols);
+
+  matrix_ = reinterpret_cast<T*>(allocator->allocate(size));
+  allocator_ = allocator;
+  capacity_ = static_cast<long>(rows) * cols;
+  if (matrix_ != nullptr) S21_STATS_ALLOCATE(size);
+  rows_ = rows;
+  cols_ = cols;
+}
+
+template <typename T>
+void BasicMatrix<T>::Reallocate(long capacity) {
+  const S21MatrixAllocator* allocator = s21_allocator;
+  long size = s21_allocator_size<T>(capacity);
+  T* data = reinterpret_cast<T*>(allocator->allocate(size));
+
+  if (data != nullptr) S21_STATS_ALLOCATE(size);
+  if (matrix_ != nullptr) {
+    std::memcpy(static_cast<void*>(data), matrix_,
+                static_cast<long>(rows_) * cols_ * sizeof(T));
+  }
+
+  Release();
+  matrix_ = data;
+  allocator_ = allocator;
+  capacity_ = capacity;
+}
+
+template <typename T>
+void BasicMatrix<T>::Grow(long size) {
+  if (size > capacity_) Reallocate(std::max(size, 2 * capacity_));
+}
+
+template <typename T>
+void BasicMatrix<T>::Release() noexcept {
+  if (matrix_ != nullptr && allocator_ != nullptr) {
+    long size = s21_allocator_size<T>(capacity_);
+    allocator_->deallocate(reinterpret_cast<double*>(matrix_), size);
+    S21_STATS_DEALLOCATE(size);
+  }
+  matrix_ = nullptr;
+  allocator_ = nullptr;
+  capacity_ = 0;
+}
+
+#define S21_MATRIX_ALLOCATOR_INSTANTIATE(T)          \
+  template void BasicMatrix<T>::Allocate(int, int);  \
+  template void BasicMatrix<T>::Reallocate(long);    \
+  template void BasicMatrix<T>::Grow(long);          \
+  template void BasicMatrix<T>::Release() noexcept;
+
+S21_MATRIX_ALLOCATOR_INSTANTIATE(double)
+S21_MATRIX_ALLOCATOR_INSTANTIATE(float)
+S21_MATRIX_ALLOCATOR_INSTANTIATE(int64_t)
+S21_MATRIX_ALLOCATOR_INSTANTIATE(std::complex<double>)
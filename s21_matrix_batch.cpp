@@ -0,0 +1,211 @@
+#include "s21_matrix_batch.h"
+
+#include "s21_matrix_kernels.h"
+#include "s21_thread_pool.h"
+
+int batch_stride(int count) {
+  int lanes = S21_MATRIX_ALIGNMENT / sizeof(double);
+  int stride = (count + lanes - 1) / lanes * lanes;
+  return stride % BATCH_BLOCK == 0 ? stride + lanes : stride;
+}
+
+S21MatrixBatch::S21MatrixBatch() noexcept
+    : count_(0), rows_(0), cols_(0), stride_(0) {}
+
+S21MatrixBatch::S21MatrixBatch(int count, int rows, int cols)
+    : count_(count), rows_(rows), cols_(cols), stride_(batch_stride(count)) {
+  if (count < 1 || rows < 1 || cols < 1)
+    throw std::invalid_argument("Sizes of rows or cols must be greater than 0");
+
+  data_ = S21Matrix(rows * cols, stride_);
+}
+
+S21MatrixBatch::S21MatrixBatch(int count, int rows, int cols,
+                               S21Matrix::Uninitialized)
+    : count_(count), rows_(rows), cols_(cols), stride_(batch_stride(count)) {
+  if (count < 1 || rows < 1 || cols < 1)
+    throw std::invalid_argument("Sizes of rows or cols must be greater than 0");
+
+  data_ = S21Matrix(rows * cols, stride_, S21Matrix::Uninitialized());
+}
+
+double& S21MatrixBatch::operator()(int index, int row, int col) {
+  if (index >= count_ || row >= rows_ || col >= cols_ || index < 0 ||
+      row < 0 || col < 0)
+    throw std::out_of_range("Incorrect parametrs of Matrix");
+
+  return Lane(row, col)[index];
+}
+
+const double& S21MatrixBatch::operator()(int index, int row, int col) const {
+  if (index >= count_ || row >= rows_ || col >= cols_ || index < 0 ||
+      row < 0 || col < 0)
+    throw std::out_of_range("Incorrect parametrs of Matrix");
+
+  return Lane(row, col)[index];
+}
+
+S21Matrix S21MatrixBatch::Get(int index) const {
+  if (index >= count_ || index < 0)
+    throw std::out_of_range("Incorrect parametrs of Matrix");
+
+  S21Matrix res(rows_, cols_, S21Matrix::Uninitialized());
+  for (int i = 0; i != rows_ * cols_; ++i) {
+    res.Data()[i] = data_.AtUnchecked(i, index);
+  }
+  return res;
+}
+
+void S21MatrixBatch::Set(int index, const S21MatrixView& o) {
+  if (index >= count_ || index < 0)
+    throw std::out_of_range("Incorrect parametrs of Matrix");
+  if (o.GetRows() != rows_ || o.GetCols() != cols_)
+    throw std::logic_error("Matrices have different size of parametrs");
+
+  for (int i = 0; i != rows_; ++i) {
+    for (int j = 0; j != cols_; ++j) Lane(i, j)[index] = o.AtUnchecked(i, j);
+  }
+}
+
+double* S21MatrixBatch::Lane(int row, int col) noexcept {
+  return data_.RowPtr(row * cols_ + col);
+}
+
+const double* S21MatrixBatch::Lane(int row, int col) const noexcept {
+  return data_.RowPtr(row * cols_ + col);
+}
+
+bool S21MatrixBatch::EqMatrix(const S21MatrixBatch& o) const noexcept {
+  if (count_ != o.count_ || rows_ != o.rows_ || cols_ != o.cols_) return false;
+
+  for (int i = 0; i != rows_; ++i) {
+    for (int j = 0; j != cols_; ++j) {
+      if (!simd_kernels().equal(Lane(i, j), o.Lane(i, j), count_, PRECISION))
+        return false;
+    }
+  }
+  return true;
+}
+
+bool S21MatrixBatch::operator==(const S21MatrixBatch& o) const noexcept {
+  return EqMatrix(o);
+}
+
+S21MatrixBatch S21MatrixBatch::operator*(const S21MatrixBatch& o) const {
+  if (count_ != o.count_ || cols_ != o.rows_) {
+    throw std::logic_error(
+        "The required parameters of matrix have different sizes");
+  }
+
+  S21MatrixBatch res(count_, rows_, o.cols_, S21Matrix::Uninitialized());
+  const double* a = data_.Data();
+  const double* b = o.data_.Data();
+  double* c = res.data_.Data();
+  int m = rows_, n = o.cols_, k = cols_;
+  long stride = stride_;
+
+  parallel_for(0, count_, BATCH_BLOCK, [=](long begin, long end) {
+    for (long l = begin; l < end; l += BATCH_BLOCK) {
+      simd_kernels().batch_multiply(a + l, b + l, m, n, k,
+                                    std::min<long>(BATCH_BLOCK, end - l),
+                                    stride, c + l, PRECISION);
+    }
+  });
+  return res;
+}
+
+void S21MatrixBatch::MulMatrix(const S21MatrixBatch& o) { *this = *this * o; }
+
+S21MatrixBatch S21MatrixBatch::Transpose() const {
+  S21MatrixBatch res(count_, cols_, rows_, S21Matrix::Uninitialized());
+  for (int i = 0; i != rows_; ++i) {
+    for (int j = 0; j != cols_; ++j) {
+      std::copy(Lane(i, j), Lane(i, j) + count_, res.Lane(j, i));
+    }
+  }
+  return res;
+}
+
+std::vector<double> S21MatrixBatch::Determinant() const {
+  if (rows_ != cols_) {
+    throw std::logic_error("The matrix isn't squared");
+  }
+
+  std::vector<double> res(count_);
+  if (rows_ > DET_CLOSED_FORM_MAX) {
+    for (int l = 0; l != count_; ++l) res[l] = Get(l).Determinant();
+    return res;
+  }
+
+  const double* a = data_.Data();
+  double* det = res.data();
+  int size = rows_;
+  long stride = stride_;
+
+  parallel_for(0, count_, BATCH_BLOCK, [=](long begin, long end) {
+    for (long l = begin; l < end; l += BATCH_BLOCK) {
+      simd_kernels().batch_determinant(
+          a + l, size, std::min<long>(BATCH_BLOCK, end - l), stride, det + l);
+    }
+  });
+  return res;
+}
+
+void check_batch_inverse(const S21MatrixBatch& batch, const double* det,
+                         long first, long lanes) {
+  int size = batch.GetRows();
+  double bound[BATCH_BLOCK], norm[BATCH_BLOCK];
+  std::fill(bound, bound + lanes, size * DBL_EPSILON);
+
+  for (int i = 0; i != size; ++i) {
+    std::fill(norm, norm + lanes, 0);
+    for (int j = 0; j != size; ++j) {
+      const double* lane = batch.Lane(i, j) + first;
+      for (long l = 0; l != lanes; ++l) norm[l] += fabs(lane[l]);
+    }
+    for (long l = 0; l != lanes; ++l) bound[l] *= norm[l];
+  }
+
+  for (long l = 0; l != lanes; ++l) {
+    if (fabs(det[l]) <= bound[l]) {
+      throw std::logic_error(
+          "The matrix is singular, the inverse matrix isn't exists");
+    }
+  }
+}
+
+S21MatrixBatch S21MatrixBatch::InverseMatrix() const {
+  if (rows_ != cols_) {
+    throw std::logic_error("The matrix isn't squared");
+  }
+
+  S21MatrixBatch res(count_, rows_, cols_, S21Matrix::Uninitialized());
+  if (rows_ > DET_CLOSED_FORM_MAX) {
+    for (int l = 0; l != count_; ++l) res.Set(l, Get(l).InverseMatrix());
+    return res;
+  }
+
+  std::vector<double> det(count_);
+  const double* a = data_.Data();
+  double* b = res.data_.Data();
+  double* d = det.data();
+  int size = rows_;
+  long stride = stride_;
+
+  parallel_for(0, count_, BATCH_BLOCK, [&, a, b, d](long begin, long end) {
+    for (long l = begin; l < end; l += BATCH_BLOCK) {
+      long lanes = std::min<long>(BATCH_BLOCK, end - l);
+      simd_kernels().batch_inverse(a + l, size, lanes, stride, b + l, d + l);
+      check_batch_inverse(*this, d + l, l, lanes);
+    }
+  });
+  return res;
+}
+
+int S21MatrixBatch::GetCount() const noexcept { return count_; }
+
+int S21MatrixBatch::GetRows() const noexcept { return rows_; }
+
+int S21MatrixBatch::GetCols() const noexcept { return cols_; }
+
+int S21MatrixBatch::GetStride() const noexcept { return stride_; }
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+class S21MatrixBatch {
+ public:
+  S21MatrixBatch() noexcept;
+  S21MatrixBatch(int count, int rows, int cols);
+  S21MatrixBatch(int count, int rows, int cols, S21Matrix::Uninitialized);
+
+  double& operator()(int index, int row, int col);
+  const double& operator()(int index, int row, int col) const;
+  S21MatrixBatch operator*(const S21MatrixBatch& o) const;
+  bool operator==(const S21MatrixBatch& o) const noexcept;
+
+  S21Matrix Get(int index) const;
+  void Set(int index, const S21MatrixView& o);
+  double* Lane(int row, int col) noexcept;
+  const double* Lane(int row, int col) const noexcept;
+
+  bool EqMatrix(const S21MatrixBatch& o) const noexcept;
+  void MulMatrix(const S21MatrixBatch& o);
+  S21MatrixBatch Transpose() const;
+  std::vector<double> Determinant() const;
+  S21MatrixBatch InverseMatrix() const;
+
+  int GetCount() const noexcept;
+  int GetRows() const noexcept;
+  int GetCols() const noexcept;
+  int GetStride() const noexcept;
+
+ private:
+  int count_, rows_, cols_, stride_;
+  S21Matrix data_;
+};
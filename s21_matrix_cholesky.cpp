@@ -0,0 +1,171 @@
+#include "s21_matrix_cholesky.h"
+
+#include "s21_matrix_kernels.h"
+#include "s21_thread_pool.h"
+
+void cholesky_panel(double* a, int size, int begin, int end) {
+  int block = end - begin;
+  std::vector<double> lt(block * block);
+
+  for (int j = 0; j != block; ++j) {
+    double* row = a + static_cast<long>(begin + j) * size + begin;
+    for (int p = 0; p != j; ++p) {
+      row[p] /= lt[p * block + p];
+      for (int q = p + 1; q != j; ++q) row[q] -= row[p] * lt[p * block + q];
+    }
+
+    double sum = row[j];
+    for (int p = 0; p != j; ++p) sum -= row[p] * row[p];
+    if (!(sum > 0))
+      throw std::logic_error("The matrix isn't positive definite");
+    row[j] = sqrt(sum);
+    for (int p = 0; p <= j; ++p) lt[p * block + j] = row[p];
+  }
+
+  const double* t = lt.data();
+  parallel_for(end, size, PARALLEL_GRAIN / (block * block) + 1,
+               [=](long first, long last) {
+                 for (long i = first; i != last; ++i) {
+                   double* row = a + i * size + begin;
+                   for (int p = 0; p != block; ++p) {
+                     row[p] /= t[p * block + p];
+                     for (int q = p + 1; q != block; ++q) {
+                       row[q] -= row[p] * t[p * block + q];
+                     }
+                   }
+                 }
+               });
+}
+
+void cholesky_factor(double* a, int size) {
+  for (int begin = 0; begin < size; begin += CHOLESKY_BLOCK) {
+    int end = std::min(begin + CHOLESKY_BLOCK, size);
+    cholesky_panel(a, size, begin, end);
+
+    for (int row = end; row < size; row += 4 * CHOLESKY_BLOCK) {
+      int rows = std::min(4 * CHOLESKY_BLOCK, size - row);
+      gemm(rows, row + rows - end, end - begin, -1,
+           a + static_cast<long>(row) * size + begin, size, 1,
+           a + static_cast<long>(end) * size + begin, 1, size, 1,
+           a + static_cast<long>(row) * size + end, size);
+    }
+  }
+}
+
+S21MatrixCholesky::S21MatrixCholesky(const S21MatrixView& a) : l_(a) {
+  if (a.GetRows() != a.GetCols())
+    throw std::logic_error("The matrix isn't squared");
+
+  int size = GetSize();
+  cholesky_factor(l_.Data(), size);
+  for (int i = 0; i != size; ++i) std::fill(l_[i] + i + 1, l_[i] + size, 0);
+}
+
+std::vector<double> S21MatrixCholesky::Solve(
+    const std::vector<double>& b) const {
+  int size = GetSize();
+  if (static_cast<long>(b.size()) != size)
+    throw std::logic_error(
+        "The required parameters of matrix have different sizes");
+
+  const double* a = l_.Data();
+  std::vector<double> x(b);
+
+  for (int i = 0; i != size; ++i) {
+    const double* row = a + static_cast<long>(i) * size;
+    double sum = x[i];
+    for (int p = 0; p != i; ++p) sum -= row[p] * x[p];
+    x[i] = sum / row[i];
+  }
+  for (int i = size - 1; i >= 0; --i) {
+    const double* row = a + static_cast<long>(i) * size;
+    x[i] /= row[i];
+    for (int p = 0; p != i; ++p) x[p] -= row[p] * x[i];
+  }
+  return x;
+}
+
+S21Matrix S21MatrixCholesky::Solve(const S21MatrixView& b) const {
+  if (b.GetRows() != GetSize())
+    throw std::logic_error(
+        "The required parameters of matrix have different sizes");
+
+  S21Matrix x(b);
+  Substitute(x.Data(), x.GetCols());
+  return x;
+}
+
+double S21MatrixCholesky::Determinant() const noexcept {
+  double res = 1;
+  for (int k = 0; k != GetSize(); ++k) {
+    res *= l_.AtUnchecked(k, k) * l_.AtUnchecked(k, k);
+  }
+  return res;
+}
+
+double S21MatrixCholesky::LogDeterminant() const noexcept {
+  double res = 0;
+  for (int k = 0; k != GetSize(); ++k) res += log(l_.AtUnchecked(k, k));
+  return 2 * res;
+}
+
+int S21MatrixCholesky::GetSize() const noexcept { return l_.GetRows(); }
+
+const S21Matrix& S21MatrixCholesky::L() const noexcept { return l_; }
+
+void S21MatrixCholesky::Substitute(double* x, int cols) const {
+  int size = GetSize();
+  const double* a = l_.Data();
+
+  for (int begin = 0; begin < size; begin += CHOLESKY_BLOCK) {
+    int end = std::min(begin + CHOLESKY_BLOCK, size);
+    if (begin != 0) {
+      gemm(end - begin, cols, begin, -1, a + static_cast<long>(begin) * size,
+           size, 1, x, cols, 1, 1, x + static_cast<long>(begin) * cols, cols);
+    }
+
+    for (int i = begin; i != end; ++i) {
+      double* row = x + static_cast<long>(i) * cols;
+      for (int p = begin; p != i; ++p) {
+        double factor = a[static_cast<long>(i) * size + p];
+        const double* src = x + static_cast<long>(p) * cols;
+        for (int j = 0; j != cols; ++j) row[j] -= factor * src[j];
+      }
+
+      double inv_diagonal = 1 / a[static_cast<long>(i) * size + i];
+      for (int j = 0; j != cols; ++j) row[j] *= inv_diagonal;
+    }
+  }
+
+  for (int end = size; end > 0; end -= CHOLESKY_BLOCK) {
+    int begin = std::max(end - CHOLESKY_BLOCK, 0);
+    if (end != size) {
+      gemm(end - begin, cols, size - end, -1,
+           a + static_cast<long>(end) * size + begin, 1, size,
+           x + static_cast<long>(end) * cols, cols, 1, 1,
+           x + static_cast<long>(begin) * cols, cols);
+    }
+
+    for (int i = end - 1; i >= begin; --i) {
+      double* row = x + static_cast<long>(i) * cols;
+      double inv_diagonal = 1 / a[static_cast<long>(i) * size + i];
+      for (int j = 0; j != cols; ++j) row[j] *= inv_diagonal;
+
+      for (int p = begin; p != i; ++p) {
+        double factor = a[static_cast<long>(i) * size + p];
+        double* dst = x + static_cast<long>(p) * cols;
+        for (int j = 0; j != cols; ++j) dst[j] -= factor * row[j];
+      }
+    }
+  }
+}
+
+template <typename M>
+S21MatrixCholesky S21MatrixExtras<M, double>::Cholesky() const {
+  return S21MatrixCholesky(static_cast<const M&>(*this));
+}
+
+template S21MatrixCholesky S21MatrixExtras<S21Matrix, double>::Cholesky()
+    const;
+template S21MatrixCholesky S21MatrixExtras<S21MatrixView, double>::Cholesky()
+    const;
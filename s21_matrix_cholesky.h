@@ -0,0 +1,24 @@
+#pragma once
+
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+// Only the lower triangle of the input is read.
+class S21MatrixCholesky {
+ public:
+  explicit S21MatrixCholesky(const S21MatrixView& a);
+
+  std::vector<double> Solve(const std::vector<double>& b) const;
+  S21Matrix Solve(const S21MatrixView& b) const;
+  double Determinant() const noexcept;
+  double LogDeterminant() const noexcept;
+
+  int GetSize() const noexcept;
+  const S21Matrix& L() const noexcept;
+
+ private:
+  void Substitute(double* x, int cols) const;
+
+  S21Matrix l_;
+};
@@ -0,0 +1,206 @@
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+#include "s21_basic_matrix.h"
+
+#define S21_MATRIX_FILE_MAGIC "S21MATRX"
+#define S21_MATRIX_FILE_VERSION 1
+#define S21_MATRIX_FILE_FLOAT64 1
+#define S21_MATRIX_FILE_FLOAT32 2
+#define S21_MATRIX_FILE_INT64 3
+#define S21_MATRIX_FILE_COMPLEX128 4
+#define S21_MATRIX_FILE_BYTE_ORDER 0x01020304u
+#define S21_MATRIX_FILE_HEADER 64
+
+struct S21MatrixFileHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t dtype;
+  uint32_t byte_order;
+  uint32_t alignment;
+  uint64_t rows;
+  uint64_t cols;
+  uint64_t data_offset;
+  char reserved[16];
+};
+
+static_assert(sizeof(S21MatrixFileHeader) == S21_MATRIX_FILE_HEADER,
+              "The file header must stay 64 bytes long");
+
+uint32_t byte_swap(uint32_t value) { return __builtin_bswap32(value); }
+
+uint64_t byte_swap(uint64_t value) { return __builtin_bswap64(value); }
+
+template <typename T>
+void byte_swap(T* data, long size) {
+  if constexpr (sizeof(T) == sizeof(uint32_t)) {
+    uint32_t* bits = reinterpret_cast<uint32_t*>(data);
+    for (long i = 0; i != size; ++i) bits[i] = byte_swap(bits[i]);
+  } else {
+    uint64_t* bits = reinterpret_cast<uint64_t*>(data);
+    long count = size * static_cast<long>(sizeof(T) / sizeof(uint64_t));
+    for (long i = 0; i != count; ++i) bits[i] = byte_swap(bits[i]);
+  }
+}
+
+template <typename T>
+uint32_t file_dtype() {
+  if constexpr (std::is_same_v<T, float>) {
+    return S21_MATRIX_FILE_FLOAT32;
+  } else if constexpr (std::is_same_v<T, int64_t>) {
+    return S21_MATRIX_FILE_INT64;
+  } else if constexpr (std::is_same_v<T, std::complex<double>>) {
+    return S21_MATRIX_FILE_COMPLEX128;
+  } else {
+    return S21_MATRIX_FILE_FLOAT64;
+  }
+}
+
+template <typename T>
+bool read_header(S21MatrixFileHeader& header, uint64_t file_size) {
+  if (std::memcmp(header.magic, S21_MATRIX_FILE_MAGIC, 8) != 0)
+    throw std::runtime_error("The file isn't a matrix file");
+
+  bool swapped = header.byte_order == byte_swap(S21_MATRIX_FILE_BYTE_ORDER);
+  if (!swapped && header.byte_order != S21_MATRIX_FILE_BYTE_ORDER)
+    throw std::runtime_error("The matrix file has an unknown byte order");
+
+  if (swapped) {
+    header.version = byte_swap(header.version);
+    header.dtype = byte_swap(header.dtype);
+    header.alignment = byte_swap(header.alignment);
+    header.rows = byte_swap(header.rows);
+    header.cols = byte_swap(header.cols);
+    header.data_offset = byte_swap(header.data_offset);
+  }
+
+  if (header.version != S21_MATRIX_FILE_VERSION)
+    throw std::runtime_error("The matrix file version isn't supported");
+  if (header.dtype != file_dtype<T>())
+    throw std::runtime_error("The matrix file element type isn't supported");
+  if (header.rows > INT_MAX || header.cols > INT_MAX ||
+      (header.rows == 0) != (header.cols == 0))
+    throw std::runtime_error("The matrix file has incorrect sizes");
+  if (header.data_offset < S21_MATRIX_FILE_HEADER ||
+      header.data_offset % alignof(T) != 0 ||
+      header.data_offset > file_size ||
+      (file_size - header.data_offset) / sizeof(T) <
+          header.rows * header.cols)
+    throw std::runtime_error("The matrix file is truncated");
+
+  return swapped;
+}
+
+template <typename T>
+void BasicMatrix<T>::Save(const std::string& path) const {
+  S21MatrixFileHeader header = {};
+  std::memcpy(header.magic, S21_MATRIX_FILE_MAGIC, 8);
+  header.version = S21_MATRIX_FILE_VERSION;
+  header.dtype = file_dtype<T>();
+  header.byte_order = S21_MATRIX_FILE_BYTE_ORDER;
+  header.alignment = S21_MATRIX_ALIGNMENT;
+  header.rows = rows_;
+  header.cols = cols_;
+  header.data_offset = S21_MATRIX_FILE_HEADER;
+
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  out.write(reinterpret_cast<const char*>(matrix_),
+            static_cast<std::streamsize>(rows_) * cols_ * sizeof(T));
+  out.close();
+
+  if (!out) throw std::runtime_error("Cannot write the matrix file " + path);
+}
+
+template <typename T>
+BasicMatrix<T> BasicMatrix<T>::Load(const std::string& path) {
+  std::ifstream in(path, std::ios::binary | std::ios::ate);
+  if (!in) throw std::runtime_error("Cannot open the matrix file " + path);
+
+  uint64_t file_size = in.tellg();
+  S21MatrixFileHeader header = {};
+  in.seekg(0);
+  if (!in.read(reinterpret_cast<char*>(&header), sizeof(header)))
+    throw std::runtime_error("The matrix file is truncated");
+
+  bool swapped = read_header<T>(header, file_size);
+  if (header.rows == 0) return BasicMatrix();
+
+  BasicMatrix res(static_cast<int>(header.rows), static_cast<int>(header.cols),
+                Uninitialized());
+  long size = static_cast<long>(header.rows * header.cols);
+  in.seekg(header.data_offset);
+  if (!in.read(reinterpret_cast<char*>(res.matrix_), size * sizeof(T)))
+    throw std::runtime_error("The matrix file is truncated");
+
+  if (swapped) byte_swap(res.matrix_, size);
+  return res;
+}
+
+void unmap_matrix(double* ptr, long size) {
+  long page = sysconf(_SC_PAGESIZE);
+  uintptr_t base = reinterpret_cast<uintptr_t>(ptr) / page * page;
+  munmap(reinterpret_cast<void*>(base),
+         reinterpret_cast<uintptr_t>(ptr) - base + size * sizeof(double));
+}
+
+const S21MatrixAllocator s21_mapped_owner = {nullptr, unmap_matrix};
+
+template <typename T>
+BasicMatrix<T> BasicMatrix<T>::Map(const std::string& path) {
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) throw std::runtime_error("Cannot open the matrix file " + path);
+
+  struct stat info;
+  S21MatrixFileHeader header = {};
+  bool ok = fstat(fd, &info) == 0 &&
+            pread(fd, &header, sizeof(header), 0) == sizeof(header);
+  if (!ok) {
+    close(fd);
+    throw std::runtime_error("The matrix file is truncated");
+  }
+
+  try {
+    if (read_header<T>(header, info.st_size))
+      throw std::runtime_error("Only native byte order files can be mapped");
+  } catch (...) {
+    close(fd);
+    throw;
+  }
+  if (header.rows == 0) {
+    close(fd);
+    return BasicMatrix();
+  }
+
+  long page = sysconf(_SC_PAGESIZE);
+  uint64_t offset = header.data_offset / page * page;
+  uint64_t length =
+      header.data_offset - offset + header.rows * header.cols * sizeof(T);
+  void* base = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd,
+                    static_cast<off_t>(offset));
+  close(fd);
+  if (base == MAP_FAILED)
+    throw std::runtime_error("Cannot map the matrix file " + path);
+
+  T* data = reinterpret_cast<T*>(static_cast<char*>(base) +
+                                 header.data_offset - offset);
+  return BasicMatrix(data, static_cast<int>(header.rows),
+                   static_cast<int>(header.cols), &s21_mapped_owner);
+}
+
+#define S21_MATRIX_IO_INSTANTIATE(T)                                  \
+  template void BasicMatrix<T>::Save(const std::string&) const;       \
+  template BasicMatrix<T> BasicMatrix<T>::Load(const std::string&);   \
+  template BasicMatrix<T> BasicMatrix<T>::Map(const std::string&);
+
+S21_MATRIX_IO_INSTANTIATE(double)
+S21_MATRIX_IO_INSTANTIATE(float)
+S21_MATRIX_IO_INSTANTIATE(int64_t)
+S21_MATRIX_IO_INSTANTIATE(std::complex<double>)
@@ -0,0 +1,1449 @@
+#include "s21_matrix_kernels.h"
+
+#include "s21_thread_pool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define S21_MATRIX_X86
+#endif
+
+template <typename T>
+T multiply(const T& a, const T& b) {
+  return a * b;
+}
+
+// Skips the NaN recovery of operator*, which turns every complex product
+// into a library call.
+std::complex<double> multiply(const std::complex<double>& a,
+                              const std::complex<double>& b) {
+  return {a.real() * b.real() - a.imag() * b.imag(),
+          a.real() * b.imag() + a.imag() * b.real()};
+}
+
+template <typename T>
+constexpr int gemm_nr() {
+  return std::is_same_v<T, float> ? GEMM_NR_FLOAT : GEMM_NR;
+}
+
+template <typename T>
+using GemmKernel = void (*)(int kc, T alpha, const T* a, const T* b, T* c,
+                            int ldc, int mr, int nr);
+
+template <typename T>
+void gemm_scale(int m, int n, T beta, T* c, int ldc) {
+  for (int i = 0; i != m; ++i) {
+    T* row = c + static_cast<long>(i) * ldc;
+    if (beta == T()) {
+      std::fill(row, row + n, T());
+    } else if (beta != T(1)) {
+      for (int j = 0; j != n; ++j) row[j] = multiply(row[j], beta);
+    }
+  }
+}
+
+template <typename T>
+void gemm_small(int m, int n, int k, T alpha, const T* a, int a_row,
+                int a_col, const T* b, int b_row, int b_col, T* c, int ldc) {
+  for (int i = 0; i != m; ++i) {
+    T* row = c + static_cast<long>(i) * ldc;
+    for (int p = 0; p != k; ++p) {
+      T scale = multiply(alpha, a[static_cast<long>(i) * a_row +
+                                  static_cast<long>(p) * a_col]);
+      if (scale == T()) continue;
+
+      const T* b_row_ptr = b + static_cast<long>(p) * b_row;
+      for (int j = 0; j != n; ++j) {
+        row[j] += multiply(scale, b_row_ptr[static_cast<long>(j) * b_col]);
+      }
+    }
+  }
+}
+
+template <typename T>
+void gemm_pack_a(int mc, int kc, const T* a, int a_row, int a_col, T* packed) {
+  for (int i = 0; i < mc; i += GEMM_MR) {
+    int mr = std::min(GEMM_MR, mc - i);
+    for (int p = 0; p != kc; ++p) {
+      for (int r = 0; r != GEMM_MR; ++r) {
+        *packed++ = r < mr ? a[static_cast<long>(i + r) * a_row +
+                               static_cast<long>(p) * a_col]
+                           : T();
+      }
+    }
+  }
+}
+
+template <typename T>
+void gemm_pack_b(int kc, int nc, const T* b, int b_row, int b_col, T* packed) {
+  constexpr int NR = gemm_nr<T>();
+
+  for (int j = 0; j < nc; j += NR) {
+    int nr = std::min(NR, nc - j);
+    for (int p = 0; p != kc; ++p) {
+      const T* src =
+          b + static_cast<long>(p) * b_row + static_cast<long>(j) * b_col;
+      for (int c = 0; c != NR; ++c) {
+        *packed++ = c < nr ? src[static_cast<long>(c) * b_col] : T();
+      }
+    }
+  }
+}
+
+// Adds alpha times an mr x nr corner of the GEMM_MR x NR accumulator tile
+// to c, for the micro-kernels' edge tiles.
+template <typename T, int NR>
+void gemm_store(const T* acc, T alpha, T* c, int ldc, int mr, int nr) {
+  for (int r = 0; r != mr; ++r) {
+    T* row = c + static_cast<long>(r) * ldc;
+    for (int j = 0; j != nr; ++j) row[j] += multiply(alpha, acc[r * NR + j]);
+  }
+}
+
+template <typename T>
+void gemm_micro_kernel(int kc, T alpha, const T* a, const T* b, T* c, int ldc,
+                       int mr, int nr) {
+  constexpr int NR = gemm_nr<T>();
+  T acc[GEMM_MR * NR] = {};
+
+  for (int p = 0; p != kc; ++p) {
+    for (int r = 0; r != GEMM_MR; ++r) {
+      T value = a[r];
+      for (int j = 0; j != NR; ++j) acc[r * NR + j] += multiply(value, b[j]);
+    }
+    a += GEMM_MR;
+    b += NR;
+  }
+
+  gemm_store<T, NR>(acc, alpha, c, ldc, mr, nr);
+}
+
+// Keeps the real and imaginary parts in separate accumulators, which lets
+// the compiler vectorize the loop over the columns of the tile.
+template <>
+void gemm_micro_kernel(int kc, std::complex<double> alpha,
+                       const std::complex<double>* a,
+                       const std::complex<double>* b, std::complex<double>* c,
+                       int ldc, int mr, int nr) {
+  constexpr int NR = gemm_nr<std::complex<double>>();
+  double re[GEMM_MR * NR] = {}, im[GEMM_MR * NR] = {};
+  const double* parts = reinterpret_cast<const double*>(b);
+
+  for (int p = 0; p != kc; ++p) {
+    for (int r = 0; r != GEMM_MR; ++r) {
+      double a_re = a[r].real(), a_im = a[r].imag();
+      for (int j = 0; j != NR; ++j) {
+        re[r * NR + j] += a_re * parts[2 * j] - a_im * parts[2 * j + 1];
+        im[r * NR + j] += a_re * parts[2 * j + 1] + a_im * parts[2 * j];
+      }
+    }
+    a += GEMM_MR;
+    parts += 2 * NR;
+  }
+
+  std::complex<double> acc[GEMM_MR * NR];
+  for (int i = 0; i != GEMM_MR * NR; ++i) acc[i] = {re[i], im[i]};
+  gemm_store<std::complex<double>, NR>(acc, alpha, c, ldc, mr, nr);
+}
+
+template <typename T>
+GemmKernel<T> gemm_kernel() {
+  if constexpr (std::is_same_v<T, double>) {
+    return simd_kernels().gemm_kernel;
+  } else if constexpr (std::is_same_v<T, float>) {
+    return simd_kernels().gemm_kernel_float;
+  } else {
+    return gemm_micro_kernel<T>;
+  }
+}
+
+template <typename T>
+void gemm_serial(int m, int n, int k, T alpha, const T* a, int a_row,
+                 int a_col, const T* b, int b_row, int b_col, T beta, T* c,
+                 int ldc) {
+  constexpr int NR = gemm_nr<T>();
+
+  gemm_scale(m, n, beta, c, ldc);
+  if (alpha == T() || k == 0) return;
+
+  if (static_cast<long>(m) * n * k <= GEMM_SMALL) {
+    gemm_small(m, n, k, alpha, a, a_row, a_col, b, b_row, b_col, c, ldc);
+    return;
+  }
+
+  GemmKernel<T> kernel = gemm_kernel<T>();
+  std::vector<T> packed_a(GEMM_MC * GEMM_KC);
+  std::vector<T> packed_b(static_cast<size_t>(GEMM_KC) *
+                          ((std::min(n, GEMM_NC) + NR - 1) / NR * NR));
+
+  for (int jc = 0; jc < n; jc += GEMM_NC) {
+    int nc = std::min(GEMM_NC, n - jc);
+
+    for (int pc = 0; pc < k; pc += GEMM_KC) {
+      int kc = std::min(GEMM_KC, k - pc);
+      gemm_pack_b(kc, nc,
+                  b + static_cast<long>(pc) * b_row +
+                      static_cast<long>(jc) * b_col,
+                  b_row, b_col, packed_b.data());
+
+      for (int ic = 0; ic < m; ic += GEMM_MC) {
+        int mc = std::min(GEMM_MC, m - ic);
+        gemm_pack_a(mc, kc,
+                    a + static_cast<long>(ic) * a_row +
+                        static_cast<long>(pc) * a_col,
+                    a_row, a_col, packed_a.data());
+
+        for (int jr = 0; jr < nc; jr += NR) {
+          for (int ir = 0; ir < mc; ir += GEMM_MR) {
+            kernel(kc, alpha, packed_a.data() + ir * kc,
+                   packed_b.data() + jr * kc,
+                   c + static_cast<long>(ic + ir) * ldc + jc + jr, ldc,
+                   std::min(GEMM_MR, mc - ir), std::min(NR, nc - jr));
+          }
+        }
+      }
+    }
+  }
+}
+
+template <typename T>
+void gemm(int m, int n, int k, s21_scalar_t<T> alpha, const T* a, int a_row,
+          int a_col, const T* b, int b_row, int b_col, s21_scalar_t<T> beta,
+          T* c, int ldc) {
+  int tiles_m = (m + GEMM_TILE_M - 1) / GEMM_TILE_M;
+  int tiles_n = (n + GEMM_TILE_N - 1) / GEMM_TILE_N;
+
+  if (static_cast<long>(m) * n * k <= GEMM_PARALLEL_MIN ||
+      tiles_m * tiles_n < 2) {
+    gemm_serial(m, n, k, alpha, a, a_row, a_col, b, b_row, b_col, beta, c, ldc);
+    return;
+  }
+
+  parallel_for(0, static_cast<long>(tiles_m) * tiles_n, 1,
+               [&](long begin, long end) {
+                 for (long tile = begin; tile != end; ++tile) {
+                   int i = static_cast<int>(tile / tiles_n) * GEMM_TILE_M;
+                   int j = static_cast<int>(tile % tiles_n) * GEMM_TILE_N;
+                   gemm_serial(std::min(GEMM_TILE_M, m - i),
+                               std::min(GEMM_TILE_N, n - j), k, alpha,
+                               a + static_cast<long>(i) * a_row, a_row, a_col,
+                               b + static_cast<long>(j) * b_col, b_row, b_col,
+                               beta, c + static_cast<long>(i) * ldc + j, ldc);
+                 }
+               });
+}
+
+template <typename T>
+void strassen_add(int rows, int cols, const T* a, int lda, const T* b, int ldb,
+                  T* c, int ldc) {
+  for (int i = 0; i != rows; ++i) {
+    for (int j = 0; j != cols; ++j) {
+      c[static_cast<long>(i) * ldc + j] =
+          a[static_cast<long>(i) * lda + j] + b[static_cast<long>(i) * ldb + j];
+    }
+  }
+}
+
+template <typename T>
+void strassen_sub(int rows, int cols, const T* a, int lda, const T* b, int ldb,
+                  T* c, int ldc) {
+  for (int i = 0; i != rows; ++i) {
+    for (int j = 0; j != cols; ++j) {
+      c[static_cast<long>(i) * ldc + j] =
+          a[static_cast<long>(i) * lda + j] - b[static_cast<long>(i) * ldb + j];
+    }
+  }
+}
+
+long strassen_workspace(int m, int n, int k, int cutoff) {
+  if (std::min({m, n, k}) <= cutoff) return 0;
+
+  int hm = m / 2, hn = n / 2, hk = k / 2;
+  return static_cast<long>(hm) * std::max(hk, hn) +
+         static_cast<long>(hk) * hn + strassen_workspace(hm, hn, hk, cutoff);
+}
+
+template <typename T>
+void strassen(int m, int n, int k, const T* a, int lda, const T* b, int ldb,
+              T* c, int ldc, int cutoff, T* work) {
+  if (std::min({m, n, k}) <= cutoff) {
+    gemm(m, n, k, 1, a, lda, 1, b, ldb, 1, 0, c, ldc);
+    return;
+  }
+
+  int hm = m / 2, hn = n / 2, hk = k / 2;
+  int ldx = std::max(hk, hn), ldy = hn;
+  T* x = work;
+  T* y = x + static_cast<long>(hm) * ldx;
+  T* next = y + static_cast<long>(hk) * ldy;
+
+  const T* a11 = a;
+  const T* a12 = a + hk;
+  const T* a21 = a + static_cast<long>(hm) * lda;
+  const T* a22 = a21 + hk;
+  const T* b11 = b;
+  const T* b12 = b + hn;
+  const T* b21 = b + static_cast<long>(hk) * ldb;
+  const T* b22 = b21 + hn;
+  T* c11 = c;
+  T* c12 = c + hn;
+  T* c21 = c + static_cast<long>(hm) * ldc;
+  T* c22 = c21 + hn;
+  strassen_sub(hm, hk, a11, lda, a21, lda, x, ldx);
+  strassen_sub(hk, hn, b22, ldb, b12, ldb, y, ldy);
+  strassen(hm, hn, hk, x, ldx, y, ldy, c21, ldc, cutoff, next);
+  strassen_add(hm, hk, a21, lda, a22, lda, x, ldx);
+  strassen_sub(hk, hn, b12, ldb, b11, ldb, y, ldy);
+  strassen(hm, hn, hk, x, ldx, y, ldy, c22, ldc, cutoff, next);
+  strassen_sub(hm, hk, x, ldx, a11, lda, x, ldx);
+  strassen_sub(hk, hn, b22, ldb, y, ldy, y, ldy);
+  strassen(hm, hn, hk, x, ldx, y, ldy, c12, ldc, cutoff, next);
+  strassen_sub(hm, hk, a12, lda, x, ldx, x, ldx);
+  strassen(hm, hn, hk, x, ldx, b22, ldb, c11, ldc, cutoff, next);
+  strassen(hm, hn, hk, a11, lda, b11, ldb, x, ldx, cutoff, next);
+  strassen_add(hm, hn, x, ldx, c12, ldc, c12, ldc);
+  strassen_add(hm, hn, c12, ldc, c21, ldc, c21, ldc);
+  strassen_add(hm, hn, c12, ldc, c22, ldc, c12, ldc);
+  strassen_add(hm, hn, c21, ldc, c22, ldc, c22, ldc);
+  strassen_add(hm, hn, c12, ldc, c11, ldc, c12, ldc);
+  strassen_sub(hk, hn, y, ldy, b21, ldb, y, ldy);
+  strassen(hm, hn, hk, a22, lda, y, ldy, c11, ldc, cutoff, next);
+  strassen_sub(hm, hn, c21, ldc, c11, ldc, c21, ldc);
+  strassen(hm, hn, hk, a12, lda, b21, ldb, c11, ldc, cutoff, next);
+  strassen_add(hm, hn, c11, ldc, x, ldx, c11, ldc);
+
+  int em = 2 * hm, en = 2 * hn, ek = 2 * hk;
+  if (ek != k) {
+    gemm(em, en, 1, 1, a + ek, lda, 1, b + static_cast<long>(ek) * ldb, ldb,
+         1, 1, c, ldc);
+  }
+  if (en != n) gemm(em, 1, k, 1, a, lda, 1, b + en, ldb, 1, 0, c + en, ldc);
+  if (em != m) {
+    gemm(1, n, k, 1, a + static_cast<long>(em) * lda, lda, 1, b, ldb, 1, 0,
+         c + static_cast<long>(em) * ldc, ldc);
+  }
+}
+
+template <typename T>
+void flush_to_zero(T* c, int rows, int cols, int ldc, double precision) {
+  using std::abs;
+
+  for (int i = 0; i != rows; ++i) {
+    T* row = c + static_cast<long>(i) * ldc;
+    for (int j = 0; j != cols; ++j) {
+      if (abs(row[j]) < precision) row[j] = T();
+    }
+  }
+}
+
+template <typename T>
+void transpose_tile_generic(const T* a, long lda, T* b, long ldb) {
+  for (int i = 0; i != 4; ++i) {
+    for (int j = 0; j != 4; ++j) b[j * ldb + i] = a[i * lda + j];
+  }
+}
+
+template <typename T>
+struct TransposeTile {
+  int tile;
+  void (*kernel)(const T* a, long lda, T* b, long ldb);
+};
+
+template <typename T>
+TransposeTile<T> transpose_tile() {
+  if constexpr (std::is_same_v<T, double>) {
+    const SimdKernels& kernels = simd_kernels();
+    return {kernels.tile, kernels.transpose_tile};
+  } else {
+    return {4, transpose_tile_generic<T>};
+  }
+}
+
+template <typename T>
+void transpose_block(const T* a, int rows, int cols, long lda, T* b, long ldb,
+                     const TransposeTile<T>& kernel) {
+  int tile = kernel.tile;
+
+  if (rows > TRANSPOSE_BLOCK || cols > TRANSPOSE_BLOCK) {
+    if (rows >= cols) {
+      int half = rows / 2 / tile * tile;
+      transpose_block(a, half, cols, lda, b, ldb, kernel);
+      transpose_block(a + half * lda, rows - half, cols, lda, b + half, ldb,
+                      kernel);
+    } else {
+      int half = cols / 2 / tile * tile;
+      transpose_block(a, rows, half, lda, b, ldb, kernel);
+      transpose_block(a + half, rows, cols - half, lda, b + half * ldb, ldb,
+                      kernel);
+    }
+    return;
+  }
+
+  int i = 0;
+  for (; i + tile <= rows; i += tile) {
+    int j = 0;
+    for (; j + tile <= cols; j += tile) {
+      kernel.kernel(a + i * lda + j, lda, b + j * ldb + i, ldb);
+    }
+    for (; j != cols; ++j) {
+      for (int r = i; r != i + tile; ++r) b[j * ldb + r] = a[r * lda + j];
+    }
+  }
+  for (; i != rows; ++i) {
+    for (int j = 0; j != cols; ++j) b[j * ldb + i] = a[i * lda + j];
+  }
+}
+
+template <typename T>
+void transpose(const T* a, int rows, int cols, long lda, T* b, long ldb) {
+  TransposeTile<T> kernel = transpose_tile<T>();
+  long panels = (rows + TRANSPOSE_PANEL - 1) / TRANSPOSE_PANEL;
+  long grain =
+      PARALLEL_GRAIN / (static_cast<long>(TRANSPOSE_PANEL) * cols + 1) + 1;
+
+  parallel_for(0, panels, grain, [&](long begin, long end) {
+    for (long panel = begin; panel != end; ++panel) {
+      long i = panel * TRANSPOSE_PANEL;
+      transpose_block(a + i * lda, std::min<long>(TRANSPOSE_PANEL, rows - i),
+                      cols, lda, b + i, ldb, kernel);
+    }
+  });
+}
+
+template <typename T>
+void transpose_in_place(T* a, int size, long lda) {
+  TransposeTile<T> kernel = transpose_tile<T>();
+  long blocks = (size + TRANSPOSE_BLOCK - 1) / TRANSPOSE_BLOCK;
+  long grain =
+      PARALLEL_GRAIN / (static_cast<long>(TRANSPOSE_BLOCK) * size + 1) + 1;
+
+  parallel_for(0, blocks, grain, [&](long begin, long end) {
+    T upper[TRANSPOSE_BLOCK * TRANSPOSE_BLOCK];
+    T lower[TRANSPOSE_BLOCK * TRANSPOSE_BLOCK];
+
+    for (long block = begin; block != end; ++block) {
+      int i = static_cast<int>(block) * TRANSPOSE_BLOCK;
+      int h = std::min(TRANSPOSE_BLOCK, size - i);
+
+      for (int j = i; j < size; j += TRANSPOSE_BLOCK) {
+        int w = std::min(TRANSPOSE_BLOCK, size - j);
+        T* top = a + i * lda + j;
+        T* bottom = a + j * lda + i;
+
+        transpose_block(top, h, w, lda, upper, h, kernel);
+        if (j != i) transpose_block(bottom, w, h, lda, lower, w, kernel);
+
+        for (int r = 0; r != w; ++r) {
+          std::copy(upper + r * h, upper + (r + 1) * h, bottom + r * lda);
+        }
+        if (j == i) continue;
+
+        for (int r = 0; r != h; ++r) {
+          std::copy(lower + r * w, lower + (r + 1) * w, top + r * lda);
+        }
+      }
+    }
+  });
+}
+
+template <typename T>
+void transpose_cycles(T* a, int rows, int cols) {
+  long last = static_cast<long>(rows) * cols - 1;
+  std::vector<bool> moved(last > 0 ? last : 0);
+
+  for (long start = 1; start < last; ++start) {
+    if (moved[start]) continue;
+
+    T value = a[start];
+    long k = start;
+    do {
+      k = k * rows % last;
+      std::swap(value, a[k]);
+      moved[k] = true;
+    } while (k != start);
+  }
+}
+
+void add_scalar(double* a, const double* b, long size) {
+  for (long i = 0; i != size; ++i) a[i] += b[i];
+}
+
+void sub_scalar(double* a, const double* b, long size) {
+  for (long i = 0; i != size; ++i) a[i] -= b[i];
+}
+
+void mul_number_scalar(double* a, long size, double number, double precision) {
+  for (long i = 0; i != size; ++i) {
+    a[i] *= number;
+    if (std::fabs(a[i]) < precision) a[i] = 0;
+  }
+}
+
+bool equal_scalar(const double* a, const double* b, long size,
+                  double precision) {
+  for (long i = 0; i != size; ++i) {
+    if (std::fabs(a[i] - b[i]) > precision) return false;
+  }
+  return true;
+}
+
+void transpose_tile_scalar(const double* a, long lda, double* b, long ldb) {
+  for (int i = 0; i != 4; ++i) {
+    for (int j = 0; j != 4; ++j) b[j * ldb + i] = a[i * lda + j];
+  }
+}
+
+template <int N>
+__attribute__((always_inline)) inline void batch_determinant_fixed(
+    const double* __restrict a, long count, long s,
+    double* __restrict det) {
+  for (long l = 0; l != count; ++l) {
+    if constexpr (N == 1) {
+      det[l] = a[l];
+    } else if constexpr (N == 2) {
+      det[l] = a[l] * a[3 * s + l] - a[s + l] * a[2 * s + l];
+    } else if constexpr (N == 3) {
+      double a0 = a[l], a1 = a[s + l], a2 = a[2 * s + l];
+      double a3 = a[3 * s + l], a4 = a[4 * s + l], a5 = a[5 * s + l];
+      double a6 = a[6 * s + l], a7 = a[7 * s + l], a8 = a[8 * s + l];
+      det[l] = a0 * (a4 * a8 - a5 * a7) - a1 * (a3 * a8 - a5 * a6) +
+               a2 * (a3 * a7 - a4 * a6);
+    } else {
+      double m[16];
+#pragma GCC unroll 16
+      for (int i = 0; i != 16; ++i) m[i] = a[i * s + l];
+
+      double s0 = m[0] * m[5] - m[1] * m[4];
+      double s1 = m[0] * m[6] - m[2] * m[4];
+      double s2 = m[0] * m[7] - m[3] * m[4];
+      double s3 = m[1] * m[6] - m[2] * m[5];
+      double s4 = m[1] * m[7] - m[3] * m[5];
+      double s5 = m[2] * m[7] - m[3] * m[6];
+      double c5 = m[10] * m[15] - m[11] * m[14];
+      double c4 = m[9] * m[15] - m[11] * m[13];
+      double c3 = m[9] * m[14] - m[10] * m[13];
+      double c2 = m[8] * m[15] - m[11] * m[12];
+      double c1 = m[8] * m[14] - m[10] * m[12];
+      double c0 = m[8] * m[13] - m[9] * m[12];
+      det[l] = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+    }
+  }
+}
+
+template <int N>
+__attribute__((always_inline)) inline void batch_inverse_fixed(
+    const double* __restrict a, long count, long s, double* __restrict b,
+    double* __restrict det) {
+  for (long first = 0; first < count; first += BATCH_LANES) {
+    long lanes = std::min<long>(BATCH_LANES, count - first);
+    double m[N * N][BATCH_LANES], r[N * N][BATCH_LANES], d[BATCH_LANES];
+    for (int i = 0; i != N * N; ++i) {
+      const double* lane = a + i * s + first;
+      if (lanes == BATCH_LANES) {
+        for (int l = 0; l != BATCH_LANES; ++l) m[i][l] = lane[l];
+      } else {
+        for (int l = 0; l != BATCH_LANES; ++l) {
+          m[i][l] = l < lanes ? lane[l] : 0;
+        }
+      }
+    }
+
+    for (int l = 0; l != BATCH_LANES; ++l) {
+      if constexpr (N == 1) {
+        d[l] = m[0][l];
+        r[0][l] = 1;
+      } else if constexpr (N == 2) {
+        d[l] = m[0][l] * m[3][l] - m[1][l] * m[2][l];
+        r[0][l] = m[3][l], r[1][l] = -m[1][l];
+        r[2][l] = -m[2][l], r[3][l] = m[0][l];
+      } else if constexpr (N == 3) {
+        r[0][l] = m[4][l] * m[8][l] - m[5][l] * m[7][l];
+        r[1][l] = m[2][l] * m[7][l] - m[1][l] * m[8][l];
+        r[2][l] = m[1][l] * m[5][l] - m[2][l] * m[4][l];
+        r[3][l] = m[5][l] * m[6][l] - m[3][l] * m[8][l];
+        r[4][l] = m[0][l] * m[8][l] - m[2][l] * m[6][l];
+        r[5][l] = m[2][l] * m[3][l] - m[0][l] * m[5][l];
+        r[6][l] = m[3][l] * m[7][l] - m[4][l] * m[6][l];
+        r[7][l] = m[1][l] * m[6][l] - m[0][l] * m[7][l];
+        r[8][l] = m[0][l] * m[4][l] - m[1][l] * m[3][l];
+        d[l] = m[0][l] * r[0][l] + m[1][l] * r[3][l] + m[2][l] * r[6][l];
+      } else {
+        double s0 = m[0][l] * m[5][l] - m[1][l] * m[4][l];
+        double s1 = m[0][l] * m[6][l] - m[2][l] * m[4][l];
+        double s2 = m[0][l] * m[7][l] - m[3][l] * m[4][l];
+        double s3 = m[1][l] * m[6][l] - m[2][l] * m[5][l];
+        double s4 = m[1][l] * m[7][l] - m[3][l] * m[5][l];
+        double s5 = m[2][l] * m[7][l] - m[3][l] * m[6][l];
+        double c5 = m[10][l] * m[15][l] - m[11][l] * m[14][l];
+        double c4 = m[9][l] * m[15][l] - m[11][l] * m[13][l];
+        double c3 = m[9][l] * m[14][l] - m[10][l] * m[13][l];
+        double c2 = m[8][l] * m[15][l] - m[11][l] * m[12][l];
+        double c1 = m[8][l] * m[14][l] - m[10][l] * m[12][l];
+        double c0 = m[8][l] * m[13][l] - m[9][l] * m[12][l];
+        d[l] = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+
+        r[0][l] = m[5][l] * c5 - m[6][l] * c4 + m[7][l] * c3;
+        r[1][l] = -m[1][l] * c5 + m[2][l] * c4 - m[3][l] * c3;
+        r[2][l] = m[13][l] * s5 - m[14][l] * s4 + m[15][l] * s3;
+        r[3][l] = -m[9][l] * s5 + m[10][l] * s4 - m[11][l] * s3;
+        r[4][l] = -m[4][l] * c5 + m[6][l] * c2 - m[7][l] * c1;
+        r[5][l] = m[0][l] * c5 - m[2][l] * c2 + m[3][l] * c1;
+        r[6][l] = -m[12][l] * s5 + m[14][l] * s2 - m[15][l] * s1;
+        r[7][l] = m[8][l] * s5 - m[10][l] * s2 + m[11][l] * s1;
+        r[8][l] = m[4][l] * c4 - m[5][l] * c2 + m[7][l] * c0;
+        r[9][l] = -m[0][l] * c4 + m[1][l] * c2 - m[3][l] * c0;
+        r[10][l] = m[12][l] * s4 - m[13][l] * s2 + m[15][l] * s0;
+        r[11][l] = -m[8][l] * s4 + m[9][l] * s2 - m[11][l] * s0;
+        r[12][l] = -m[4][l] * c3 + m[5][l] * c1 - m[6][l] * c0;
+        r[13][l] = m[0][l] * c3 - m[1][l] * c1 + m[2][l] * c0;
+        r[14][l] = -m[12][l] * s3 + m[13][l] * s1 - m[14][l] * s0;
+        r[15][l] = m[8][l] * s3 - m[9][l] * s1 + m[10][l] * s0;
+      }
+    }
+
+    for (int l = 0; l != BATCH_LANES; ++l) {
+      double inv_det = 1 / d[l];
+      for (int i = 0; i != N * N; ++i) r[i][l] *= inv_det;
+    }
+
+    for (int i = 0; i != N * N; ++i) {
+      double* lane = b + i * s + first;
+      if (lanes == BATCH_LANES) {
+        for (int l = 0; l != BATCH_LANES; ++l) lane[l] = r[i][l];
+      } else {
+        for (int l = 0; l != lanes; ++l) lane[l] = r[i][l];
+      }
+    }
+    for (long l = 0; l != lanes; ++l) det[first + l] = d[l];
+  }
+}
+
+__attribute__((always_inline)) inline void batch_determinant_generic(
+    const double* a, int size, long count, long stride, double* det) {
+  switch (size) {
+    case 1:
+      return batch_determinant_fixed<1>(a, count, stride, det);
+    case 2:
+      return batch_determinant_fixed<2>(a, count, stride, det);
+    case 3:
+      return batch_determinant_fixed<3>(a, count, stride, det);
+    default:
+      return batch_determinant_fixed<4>(a, count, stride, det);
+  }
+}
+
+__attribute__((always_inline)) inline void batch_inverse_generic(
+    const double* a, int size, long count, long stride, double* b,
+    double* det) {
+  switch (size) {
+    case 1:
+      return batch_inverse_fixed<1>(a, count, stride, b, det);
+    case 2:
+      return batch_inverse_fixed<2>(a, count, stride, b, det);
+    case 3:
+      return batch_inverse_fixed<3>(a, count, stride, b, det);
+    default:
+      return batch_inverse_fixed<4>(a, count, stride, b, det);
+  }
+}
+
+__attribute__((always_inline)) inline void batch_multiply_generic(
+    const double* __restrict a, const double* __restrict b, int m, int n,
+    int k, long count, long stride, double* __restrict c, double precision) {
+  for (int i = 0; i != m; ++i) {
+    for (int j = 0; j != n; ++j) {
+      double* out = c + (i * n + j) * stride;
+      for (long l = 0; l != count; ++l) out[l] = 0;
+
+      for (int p = 0; p != k; ++p) {
+        const double* left = a + (i * k + p) * stride;
+        const double* right = b + (p * n + j) * stride;
+        for (long l = 0; l != count; ++l) out[l] += left[l] * right[l];
+      }
+
+      for (long l = 0; l != count; ++l) {
+        out[l] = std::fabs(out[l]) < precision ? 0 : out[l];
+      }
+    }
+  }
+}
+
+void batch_determinant_scalar(const double* a, int size, long count,
+                              long stride, double* det) {
+  batch_determinant_generic(a, size, count, stride, det);
+}
+
+void batch_inverse_scalar(const double* a, int size, long count, long stride,
+                          double* b, double* det) {
+  batch_inverse_generic(a, size, count, stride, b, det);
+}
+
+void batch_multiply_scalar(const double* a, const double* b, int m, int n,
+                           int k, long count, long stride, double* c,
+                           double precision) {
+  batch_multiply_generic(a, b, m, n, k, count, stride, c, precision);
+}
+
+void add_float_scalar(float* a, const float* b, long size) {
+  for (long i = 0; i != size; ++i) a[i] += b[i];
+}
+
+void sub_float_scalar(float* a, const float* b, long size) {
+  for (long i = 0; i != size; ++i) a[i] -= b[i];
+}
+
+void mul_number_float_scalar(float* a, long size, float number,
+                             float precision) {
+  for (long i = 0; i != size; ++i) {
+    a[i] *= number;
+    if (std::fabs(a[i]) < precision) a[i] = 0;
+  }
+}
+
+bool equal_float_scalar(const float* a, const float* b, long size,
+                        float precision) {
+  for (long i = 0; i != size; ++i) {
+    if (std::fabs(a[i] - b[i]) > precision) return false;
+  }
+  return true;
+}
+
+#ifdef S21_MATRIX_X86
+
+__attribute__((target("sse2"))) void add_sse2(double* a, const double* b,
+                                              long size) {
+  long i = 0;
+  for (; i + 2 <= size; i += 2) {
+    _mm_storeu_pd(a + i, _mm_add_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+  }
+  add_scalar(a + i, b + i, size - i);
+}
+
+__attribute__((target("sse2"))) void sub_sse2(double* a, const double* b,
+                                              long size) {
+  long i = 0;
+  for (; i + 2 <= size; i += 2) {
+    _mm_storeu_pd(a + i, _mm_sub_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+  }
+  sub_scalar(a + i, b + i, size - i);
+}
+
+__attribute__((target("sse2"))) void mul_number_sse2(double* a, long size,
+                                                     double number,
+                                                     double precision) {
+  __m128d factor = _mm_set1_pd(number);
+  __m128d limit = _mm_set1_pd(precision);
+  __m128d sign = _mm_set1_pd(-0.0);
+  long i = 0;
+  for (; i + 2 <= size; i += 2) {
+    __m128d value = _mm_mul_pd(_mm_loadu_pd(a + i), factor);
+    __m128d tiny = _mm_cmplt_pd(_mm_andnot_pd(sign, value), limit);
+    _mm_storeu_pd(a + i, _mm_andnot_pd(tiny, value));
+  }
+  mul_number_scalar(a + i, size - i, number, precision);
+}
+
+__attribute__((target("sse2"))) bool equal_sse2(const double* a,
+                                                const double* b, long size,
+                                                double precision) {
+  __m128d limit = _mm_set1_pd(precision);
+  __m128d sign = _mm_set1_pd(-0.0);
+  long i = 0;
+  for (; i + 2 <= size; i += 2) {
+    __m128d diff = _mm_sub_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i));
+    if (_mm_movemask_pd(_mm_cmpgt_pd(_mm_andnot_pd(sign, diff), limit))) {
+      return false;
+    }
+  }
+  return equal_scalar(a + i, b + i, size - i, precision);
+}
+
+__attribute__((target("sse2"))) void transpose_tile_sse2(const double* a,
+                                                         long lda, double* b,
+                                                         long ldb) {
+  __m128d r0 = _mm_loadu_pd(a);
+  __m128d r1 = _mm_loadu_pd(a + lda);
+  _mm_storeu_pd(b, _mm_unpacklo_pd(r0, r1));
+  _mm_storeu_pd(b + ldb, _mm_unpackhi_pd(r0, r1));
+}
+
+__attribute__((target("avx2"))) void add_avx2(double* a, const double* b,
+                                              long size) {
+  long i = 0;
+  for (; i + 4 <= size; i += 4) {
+    _mm256_storeu_pd(a + i, _mm256_add_pd(_mm256_loadu_pd(a + i),
+                                          _mm256_loadu_pd(b + i)));
+  }
+  add_scalar(a + i, b + i, size - i);
+}
+
+__attribute__((target("avx2"))) void sub_avx2(double* a, const double* b,
+                                              long size) {
+  long i = 0;
+  for (; i + 4 <= size; i += 4) {
+    _mm256_storeu_pd(a + i, _mm256_sub_pd(_mm256_loadu_pd(a + i),
+                                          _mm256_loadu_pd(b + i)));
+  }
+  sub_scalar(a + i, b + i, size - i);
+}
+
+__attribute__((target("avx2"))) void mul_number_avx2(double* a, long size,
+                                                     double number,
+                                                     double precision) {
+  __m256d factor = _mm256_set1_pd(number);
+  __m256d limit = _mm256_set1_pd(precision);
+  __m256d sign = _mm256_set1_pd(-0.0);
+  long i = 0;
+  for (; i + 4 <= size; i += 4) {
+    __m256d value = _mm256_mul_pd(_mm256_loadu_pd(a + i), factor);
+    __m256d tiny =
+        _mm256_cmp_pd(_mm256_andnot_pd(sign, value), limit, _CMP_LT_OQ);
+    _mm256_storeu_pd(a + i, _mm256_andnot_pd(tiny, value));
+  }
+  mul_number_scalar(a + i, size - i, number, precision);
+}
+
+__attribute__((target("avx2"))) bool equal_avx2(const double* a,
+                                                const double* b, long size,
+                                                double precision) {
+  __m256d limit = _mm256_set1_pd(precision);
+  __m256d sign = _mm256_set1_pd(-0.0);
+  long i = 0;
+  for (; i + 4 <= size; i += 4) {
+    __m256d diff =
+        _mm256_sub_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i));
+    __m256d far =
+        _mm256_cmp_pd(_mm256_andnot_pd(sign, diff), limit, _CMP_GT_OQ);
+    if (_mm256_movemask_pd(far)) return false;
+  }
+  return equal_scalar(a + i, b + i, size - i, precision);
+}
+
+__attribute__((target("avx2"))) void transpose_tile_avx2(const double* a,
+                                                         long lda, double* b,
+                                                         long ldb) {
+  __m256d t0 = _mm256_loadu_pd(a);
+  __m256d t1 = _mm256_loadu_pd(a + lda);
+  __m256d t2 = _mm256_loadu_pd(a + 2 * lda);
+  __m256d t3 = _mm256_loadu_pd(a + 3 * lda);
+
+  __m256d u0 = _mm256_unpacklo_pd(t0, t1);
+  __m256d u1 = _mm256_unpackhi_pd(t0, t1);
+  __m256d u2 = _mm256_unpacklo_pd(t2, t3);
+  __m256d u3 = _mm256_unpackhi_pd(t2, t3);
+
+  _mm256_storeu_pd(b, _mm256_permute2f128_pd(u0, u2, 0x20));
+  _mm256_storeu_pd(b + ldb, _mm256_permute2f128_pd(u1, u3, 0x20));
+  _mm256_storeu_pd(b + 2 * ldb, _mm256_permute2f128_pd(u0, u2, 0x31));
+  _mm256_storeu_pd(b + 3 * ldb, _mm256_permute2f128_pd(u1, u3, 0x31));
+}
+
+__attribute__((target("avx512f"))) void add_avx512(double* a, const double* b,
+                                                   long size) {
+  long i = 0;
+  for (; i + 8 <= size; i += 8) {
+    _mm512_storeu_pd(a + i, _mm512_add_pd(_mm512_loadu_pd(a + i),
+                                          _mm512_loadu_pd(b + i)));
+  }
+  add_scalar(a + i, b + i, size - i);
+}
+
+__attribute__((target("avx512f"))) void sub_avx512(double* a, const double* b,
+                                                   long size) {
+  long i = 0;
+  for (; i + 8 <= size; i += 8) {
+    _mm512_storeu_pd(a + i, _mm512_sub_pd(_mm512_loadu_pd(a + i),
+                                          _mm512_loadu_pd(b + i)));
+  }
+  sub_scalar(a + i, b + i, size - i);
+}
+
+__attribute__((target("avx512f"))) void mul_number_avx512(double* a, long size,
+                                                          double number,
+                                                          double precision) {
+  __m512d factor = _mm512_set1_pd(number);
+  __m512d limit = _mm512_set1_pd(precision);
+  long i = 0;
+  for (; i + 8 <= size; i += 8) {
+    __m512d value = _mm512_mul_pd(_mm512_loadu_pd(a + i), factor);
+    __mmask8 tiny =
+        _mm512_cmp_pd_mask(_mm512_abs_pd(value), limit, _CMP_LT_OQ);
+    _mm512_storeu_pd(a + i,
+                     _mm512_mask_mov_pd(value, tiny, _mm512_setzero_pd()));
+  }
+  mul_number_scalar(a + i, size - i, number, precision);
+}
+
+__attribute__((target("avx512f"))) bool equal_avx512(const double* a,
+                                                     const double* b,
+                                                     long size,
+                                                     double precision) {
+  __m512d limit = _mm512_set1_pd(precision);
+  long i = 0;
+  for (; i + 8 <= size; i += 8) {
+    __m512d diff =
+        _mm512_sub_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i));
+    if (_mm512_cmp_pd_mask(_mm512_abs_pd(diff), limit, _CMP_GT_OQ)) {
+      return false;
+    }
+  }
+  return equal_scalar(a + i, b + i, size - i, precision);
+}
+
+__attribute__((target("avx512f"))) void transpose_tile_avx512(const double* a,
+                                                              long lda,
+                                                              double* b,
+                                                              long ldb) {
+  __m512d t[8], u[8];
+  for (int i = 0; i != 8; i += 2) {
+    __m512d r0 = _mm512_loadu_pd(a + i * lda);
+    __m512d r1 = _mm512_loadu_pd(a + (i + 1) * lda);
+    t[i] = _mm512_maskz_unpacklo_pd(0xff, r0, r1);
+    t[i + 1] = _mm512_maskz_unpackhi_pd(0xff, r0, r1);
+  }
+
+  for (int i = 0; i != 8; i += 4) {
+    u[i] = _mm512_maskz_shuffle_f64x2(0xff, t[i], t[i + 2], 0x88);
+    u[i + 1] = _mm512_maskz_shuffle_f64x2(0xff, t[i + 1], t[i + 3], 0x88);
+    u[i + 2] = _mm512_maskz_shuffle_f64x2(0xff, t[i], t[i + 2], 0xdd);
+    u[i + 3] = _mm512_maskz_shuffle_f64x2(0xff, t[i + 1], t[i + 3], 0xdd);
+  }
+
+  for (int j = 0; j != 4; ++j) {
+    __m512d low = _mm512_maskz_shuffle_f64x2(0xff, u[j], u[j + 4], 0x88);
+    __m512d high = _mm512_maskz_shuffle_f64x2(0xff, u[j], u[j + 4], 0xdd);
+    _mm512_storeu_pd(b + j * ldb, low);
+    _mm512_storeu_pd(b + (j + 4) * ldb, high);
+  }
+}
+
+__attribute__((target("sse2"))) void batch_determinant_sse2(
+    const double* a, int size, long count, long stride, double* det) {
+  batch_determinant_generic(a, size, count, stride, det);
+}
+
+__attribute__((target("sse2"))) void batch_inverse_sse2(
+    const double* a, int size, long count, long stride, double* b,
+    double* det) {
+  batch_inverse_generic(a, size, count, stride, b, det);
+}
+
+__attribute__((target("sse2"))) void batch_multiply_sse2(
+    const double* a, const double* b, int m, int n, int k, long count,
+    long stride, double* c, double precision) {
+  batch_multiply_generic(a, b, m, n, k, count, stride, c, precision);
+}
+
+__attribute__((target("avx2"))) void batch_determinant_avx2(
+    const double* a, int size, long count, long stride, double* det) {
+  batch_determinant_generic(a, size, count, stride, det);
+}
+
+__attribute__((target("avx2"))) void batch_inverse_avx2(
+    const double* a, int size, long count, long stride, double* b,
+    double* det) {
+  batch_inverse_generic(a, size, count, stride, b, det);
+}
+
+__attribute__((target("avx2"))) void batch_multiply_avx2(
+    const double* a, const double* b, int m, int n, int k, long count,
+    long stride, double* c, double precision) {
+  batch_multiply_generic(a, b, m, n, k, count, stride, c, precision);
+}
+
+__attribute__((target("avx512f"))) void batch_determinant_avx512(
+    const double* a, int size, long count, long stride, double* det) {
+  batch_determinant_generic(a, size, count, stride, det);
+}
+
+__attribute__((target("avx512f"))) void batch_inverse_avx512(
+    const double* a, int size, long count, long stride, double* b,
+    double* det) {
+  batch_inverse_generic(a, size, count, stride, b, det);
+}
+
+__attribute__((target("avx512f"))) void batch_multiply_avx512(
+    const double* a, const double* b, int m, int n, int k, long count,
+    long stride, double* c, double precision) {
+  batch_multiply_generic(a, b, m, n, k, count, stride, c, precision);
+}
+
+__attribute__((target("sse2"))) void gemm_kernel_sse2(int kc, double alpha,
+                                                      const double* a,
+                                                      const double* b,
+                                                      double* c, int ldc,
+                                                      int mr, int nr) {
+  __m128d acc[GEMM_MR][4] = {};
+
+  for (int p = 0; p != kc; ++p) {
+    __m128d b0 = _mm_loadu_pd(b), b1 = _mm_loadu_pd(b + 2);
+    __m128d b2 = _mm_loadu_pd(b + 4), b3 = _mm_loadu_pd(b + 6);
+    for (int r = 0; r != GEMM_MR; ++r) {
+      __m128d value = _mm_set1_pd(a[r]);
+      acc[r][0] = _mm_add_pd(acc[r][0], _mm_mul_pd(value, b0));
+      acc[r][1] = _mm_add_pd(acc[r][1], _mm_mul_pd(value, b1));
+      acc[r][2] = _mm_add_pd(acc[r][2], _mm_mul_pd(value, b2));
+      acc[r][3] = _mm_add_pd(acc[r][3], _mm_mul_pd(value, b3));
+    }
+    a += GEMM_MR;
+    b += GEMM_NR;
+  }
+
+  __m128d scale = _mm_set1_pd(alpha);
+  if (mr == GEMM_MR && nr == GEMM_NR) {
+    for (int r = 0; r != GEMM_MR; ++r) {
+      double* row = c + static_cast<long>(r) * ldc;
+      for (int v = 0; v != 4; ++v) {
+        _mm_storeu_pd(row + 2 * v,
+                      _mm_add_pd(_mm_loadu_pd(row + 2 * v),
+                                 _mm_mul_pd(scale, acc[r][v])));
+      }
+    }
+    return;
+  }
+
+  double tile[GEMM_MR * GEMM_NR];
+  for (int r = 0; r != GEMM_MR; ++r) {
+    for (int v = 0; v != 4; ++v) {
+      _mm_storeu_pd(tile + r * GEMM_NR + 2 * v, acc[r][v]);
+    }
+  }
+  gemm_store<double, GEMM_NR>(tile, alpha, c, ldc, mr, nr);
+}
+
+__attribute__((target("avx2"))) void gemm_kernel_avx2(int kc, double alpha,
+                                                      const double* a,
+                                                      const double* b,
+                                                      double* c, int ldc,
+                                                      int mr, int nr) {
+  __m256d acc[GEMM_MR][2] = {};
+
+  for (int p = 0; p != kc; ++p) {
+    __m256d b0 = _mm256_loadu_pd(b), b1 = _mm256_loadu_pd(b + 4);
+    for (int r = 0; r != GEMM_MR; ++r) {
+      __m256d value = _mm256_broadcast_sd(a + r);
+      acc[r][0] = _mm256_add_pd(acc[r][0], _mm256_mul_pd(value, b0));
+      acc[r][1] = _mm256_add_pd(acc[r][1], _mm256_mul_pd(value, b1));
+    }
+    a += GEMM_MR;
+    b += GEMM_NR;
+  }
+
+  __m256d scale = _mm256_set1_pd(alpha);
+  if (mr == GEMM_MR && nr == GEMM_NR) {
+    for (int r = 0; r != GEMM_MR; ++r) {
+      double* row = c + static_cast<long>(r) * ldc;
+      for (int v = 0; v != 2; ++v) {
+        _mm256_storeu_pd(row + 4 * v,
+                         _mm256_add_pd(_mm256_loadu_pd(row + 4 * v),
+                                       _mm256_mul_pd(scale, acc[r][v])));
+      }
+    }
+    return;
+  }
+
+  double tile[GEMM_MR * GEMM_NR];
+  for (int r = 0; r != GEMM_MR; ++r) {
+    for (int v = 0; v != 2; ++v) {
+      _mm256_storeu_pd(tile + r * GEMM_NR + 4 * v, acc[r][v]);
+    }
+  }
+  gemm_store<double, GEMM_NR>(tile, alpha, c, ldc, mr, nr);
+}
+
+__attribute__((target("avx512f"))) void gemm_kernel_avx512(
+    int kc, double alpha, const double* a, const double* b, double* c, int ldc,
+    int mr, int nr) {
+  __m512d acc[GEMM_MR] = {};
+
+  for (int p = 0; p != kc; ++p) {
+    __m512d row = _mm512_loadu_pd(b);
+    for (int r = 0; r != GEMM_MR; ++r) {
+      acc[r] = _mm512_fmadd_pd(_mm512_set1_pd(a[r]), row, acc[r]);
+    }
+    a += GEMM_MR;
+    b += GEMM_NR;
+  }
+
+  __m512d scale = _mm512_set1_pd(alpha);
+  if (mr == GEMM_MR && nr == GEMM_NR) {
+    for (int r = 0; r != GEMM_MR; ++r) {
+      double* row = c + static_cast<long>(r) * ldc;
+      _mm512_storeu_pd(row,
+                       _mm512_fmadd_pd(scale, acc[r], _mm512_loadu_pd(row)));
+    }
+    return;
+  }
+
+  double tile[GEMM_MR * GEMM_NR];
+  for (int r = 0; r != GEMM_MR; ++r) {
+    _mm512_storeu_pd(tile + r * GEMM_NR, acc[r]);
+  }
+  gemm_store<double, GEMM_NR>(tile, alpha, c, ldc, mr, nr);
+}
+
+__attribute__((target("sse2"))) void add_float_sse2(float* a, const float* b,
+                                                    long size) {
+  long i = 0;
+  for (; i + 4 <= size; i += 4) {
+    _mm_storeu_ps(a + i, _mm_add_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+  }
+  add_float_scalar(a + i, b + i, size - i);
+}
+
+__attribute__((target("sse2"))) void sub_float_sse2(float* a, const float* b,
+                                                    long size) {
+  long i = 0;
+  for (; i + 4 <= size; i += 4) {
+    _mm_storeu_ps(a + i, _mm_sub_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+  }
+  sub_float_scalar(a + i, b + i, size - i);
+}
+
+__attribute__((target("sse2"))) void mul_number_float_sse2(float* a, long size,
+                                                           float number,
+                                                           float precision) {
+  __m128 factor = _mm_set1_ps(number);
+  __m128 limit = _mm_set1_ps(precision);
+  __m128 sign = _mm_set1_ps(-0.0f);
+  long i = 0;
+  for (; i + 4 <= size; i += 4) {
+    __m128 value = _mm_mul_ps(_mm_loadu_ps(a + i), factor);
+    __m128 tiny = _mm_cmplt_ps(_mm_andnot_ps(sign, value), limit);
+    _mm_storeu_ps(a + i, _mm_andnot_ps(tiny, value));
+  }
+  mul_number_float_scalar(a + i, size - i, number, precision);
+}
+
+__attribute__((target("sse2"))) bool equal_float_sse2(const float* a,
+                                                      const float* b,
+                                                      long size,
+                                                      float precision) {
+  __m128 limit = _mm_set1_ps(precision);
+  __m128 sign = _mm_set1_ps(-0.0f);
+  long i = 0;
+  for (; i + 4 <= size; i += 4) {
+    __m128 diff = _mm_sub_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i));
+    if (_mm_movemask_ps(_mm_cmpgt_ps(_mm_andnot_ps(sign, diff), limit))) {
+      return false;
+    }
+  }
+  return equal_float_scalar(a + i, b + i, size - i, precision);
+}
+
+__attribute__((target("sse2"))) void gemm_kernel_float_sse2(
+    int kc, float alpha, const float* a, const float* b, float* c, int ldc,
+    int mr, int nr) {
+  __m128 acc[GEMM_MR][4] = {};
+
+  for (int p = 0; p != kc; ++p) {
+    __m128 b0 = _mm_loadu_ps(b), b1 = _mm_loadu_ps(b + 4);
+    __m128 b2 = _mm_loadu_ps(b + 8), b3 = _mm_loadu_ps(b + 12);
+    for (int r = 0; r != GEMM_MR; ++r) {
+      __m128 value = _mm_set1_ps(a[r]);
+      acc[r][0] = _mm_add_ps(acc[r][0], _mm_mul_ps(value, b0));
+      acc[r][1] = _mm_add_ps(acc[r][1], _mm_mul_ps(value, b1));
+      acc[r][2] = _mm_add_ps(acc[r][2], _mm_mul_ps(value, b2));
+      acc[r][3] = _mm_add_ps(acc[r][3], _mm_mul_ps(value, b3));
+    }
+    a += GEMM_MR;
+    b += GEMM_NR_FLOAT;
+  }
+
+  __m128 scale = _mm_set1_ps(alpha);
+  if (mr == GEMM_MR && nr == GEMM_NR_FLOAT) {
+    for (int r = 0; r != GEMM_MR; ++r) {
+      float* row = c + static_cast<long>(r) * ldc;
+      for (int v = 0; v != 4; ++v) {
+        _mm_storeu_ps(row + 4 * v, _mm_add_ps(_mm_loadu_ps(row + 4 * v),
+                                              _mm_mul_ps(scale, acc[r][v])));
+      }
+    }
+    return;
+  }
+
+  float tile[GEMM_MR * GEMM_NR_FLOAT];
+  for (int r = 0; r != GEMM_MR; ++r) {
+    for (int v = 0; v != 4; ++v) {
+      _mm_storeu_ps(tile + r * GEMM_NR_FLOAT + 4 * v, acc[r][v]);
+    }
+  }
+  gemm_store<float, GEMM_NR_FLOAT>(tile, alpha, c, ldc, mr, nr);
+}
+
+__attribute__((target("avx2"))) void add_float_avx2(float* a, const float* b,
+                                                    long size) {
+  long i = 0;
+  for (; i + 8 <= size; i += 8) {
+    _mm256_storeu_ps(a + i, _mm256_add_ps(_mm256_loadu_ps(a + i),
+                                          _mm256_loadu_ps(b + i)));
+  }
+  add_float_scalar(a + i, b + i, size - i);
+}
+
+__attribute__((target("avx2"))) void sub_float_avx2(float* a, const float* b,
+                                                    long size) {
+  long i = 0;
+  for (; i + 8 <= size; i += 8) {
+    _mm256_storeu_ps(a + i, _mm256_sub_ps(_mm256_loadu_ps(a + i),
+                                          _mm256_loadu_ps(b + i)));
+  }
+  sub_float_scalar(a + i, b + i, size - i);
+}
+
+__attribute__((target("avx2"))) void mul_number_float_avx2(float* a, long size,
+                                                           float number,
+                                                           float precision) {
+  __m256 factor = _mm256_set1_ps(number);
+  __m256 limit = _mm256_set1_ps(precision);
+  __m256 sign = _mm256_set1_ps(-0.0f);
+  long i = 0;
+  for (; i + 8 <= size; i += 8) {
+    __m256 value = _mm256_mul_ps(_mm256_loadu_ps(a + i), factor);
+    __m256 tiny =
+        _mm256_cmp_ps(_mm256_andnot_ps(sign, value), limit, _CMP_LT_OQ);
+    _mm256_storeu_ps(a + i, _mm256_andnot_ps(tiny, value));
+  }
+  mul_number_float_scalar(a + i, size - i, number, precision);
+}
+
+__attribute__((target("avx2"))) bool equal_float_avx2(const float* a,
+                                                      const float* b,
+                                                      long size,
+                                                      float precision) {
+  __m256 limit = _mm256_set1_ps(precision);
+  __m256 sign = _mm256_set1_ps(-0.0f);
+  long i = 0;
+  for (; i + 8 <= size; i += 8) {
+    __m256 diff = _mm256_sub_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i));
+    __m256 far =
+        _mm256_cmp_ps(_mm256_andnot_ps(sign, diff), limit, _CMP_GT_OQ);
+    if (_mm256_movemask_ps(far)) return false;
+  }
+  return equal_float_scalar(a + i, b + i, size - i, precision);
+}
+
+__attribute__((target("avx2"))) void gemm_kernel_float_avx2(
+    int kc, float alpha, const float* a, const float* b, float* c, int ldc,
+    int mr, int nr) {
+  __m256 acc[GEMM_MR][2] = {};
+
+  for (int p = 0; p != kc; ++p) {
+    __m256 b0 = _mm256_loadu_ps(b), b1 = _mm256_loadu_ps(b + 8);
+    for (int r = 0; r != GEMM_MR; ++r) {
+      __m256 value = _mm256_broadcast_ss(a + r);
+      acc[r][0] = _mm256_add_ps(acc[r][0], _mm256_mul_ps(value, b0));
+      acc[r][1] = _mm256_add_ps(acc[r][1], _mm256_mul_ps(value, b1));
+    }
+    a += GEMM_MR;
+    b += GEMM_NR_FLOAT;
+  }
+
+  __m256 scale = _mm256_set1_ps(alpha);
+  if (mr == GEMM_MR && nr == GEMM_NR_FLOAT) {
+    for (int r = 0; r != GEMM_MR; ++r) {
+      float* row = c + static_cast<long>(r) * ldc;
+      for (int v = 0; v != 2; ++v) {
+        _mm256_storeu_ps(row + 8 * v,
+                         _mm256_add_ps(_mm256_loadu_ps(row + 8 * v),
+                                       _mm256_mul_ps(scale, acc[r][v])));
+      }
+    }
+    return;
+  }
+
+  float tile[GEMM_MR * GEMM_NR_FLOAT];
+  for (int r = 0; r != GEMM_MR; ++r) {
+    for (int v = 0; v != 2; ++v) {
+      _mm256_storeu_ps(tile + r * GEMM_NR_FLOAT + 8 * v, acc[r][v]);
+    }
+  }
+  gemm_store<float, GEMM_NR_FLOAT>(tile, alpha, c, ldc, mr, nr);
+}
+
+__attribute__((target("avx512f"))) void add_float_avx512(float* a,
+                                                         const float* b,
+                                                         long size) {
+  long i = 0;
+  for (; i + 16 <= size; i += 16) {
+    _mm512_storeu_ps(a + i, _mm512_add_ps(_mm512_loadu_ps(a + i),
+                                          _mm512_loadu_ps(b + i)));
+  }
+  add_float_scalar(a + i, b + i, size - i);
+}
+
+__attribute__((target("avx512f"))) void sub_float_avx512(float* a,
+                                                         const float* b,
+                                                         long size) {
+  long i = 0;
+  for (; i + 16 <= size; i += 16) {
+    _mm512_storeu_ps(a + i, _mm512_sub_ps(_mm512_loadu_ps(a + i),
+                                          _mm512_loadu_ps(b + i)));
+  }
+  sub_float_scalar(a + i, b + i, size - i);
+}
+
+__attribute__((target("avx512f"))) void mul_number_float_avx512(
+    float* a, long size, float number, float precision) {
+  __m512 factor = _mm512_set1_ps(number);
+  __m512 limit = _mm512_set1_ps(precision);
+  long i = 0;
+  for (; i + 16 <= size; i += 16) {
+    __m512 value = _mm512_mul_ps(_mm512_loadu_ps(a + i), factor);
+    __mmask16 tiny =
+        _mm512_cmp_ps_mask(_mm512_abs_ps(value), limit, _CMP_LT_OQ);
+    _mm512_storeu_ps(a + i,
+                     _mm512_mask_mov_ps(value, tiny, _mm512_setzero_ps()));
+  }
+  mul_number_float_scalar(a + i, size - i, number, precision);
+}
+
+__attribute__((target("avx512f"))) bool equal_float_avx512(const float* a,
+                                                           const float* b,
+                                                           long size,
+                                                           float precision) {
+  __m512 limit = _mm512_set1_ps(precision);
+  long i = 0;
+  for (; i + 16 <= size; i += 16) {
+    __m512 diff = _mm512_sub_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i));
+    if (_mm512_cmp_ps_mask(_mm512_abs_ps(diff), limit, _CMP_GT_OQ)) {
+      return false;
+    }
+  }
+  return equal_float_scalar(a + i, b + i, size - i, precision);
+}
+
+__attribute__((target("avx512f"))) void gemm_kernel_float_avx512(
+    int kc, float alpha, const float* a, const float* b, float* c, int ldc,
+    int mr, int nr) {
+  __m512 acc[GEMM_MR] = {};
+
+  for (int p = 0; p != kc; ++p) {
+    __m512 row = _mm512_loadu_ps(b);
+    for (int r = 0; r != GEMM_MR; ++r) {
+      acc[r] = _mm512_fmadd_ps(_mm512_set1_ps(a[r]), row, acc[r]);
+    }
+    a += GEMM_MR;
+    b += GEMM_NR_FLOAT;
+  }
+
+  __m512 scale = _mm512_set1_ps(alpha);
+  if (mr == GEMM_MR && nr == GEMM_NR_FLOAT) {
+    for (int r = 0; r != GEMM_MR; ++r) {
+      float* row = c + static_cast<long>(r) * ldc;
+      _mm512_storeu_ps(row,
+                       _mm512_fmadd_ps(scale, acc[r], _mm512_loadu_ps(row)));
+    }
+    return;
+  }
+
+  float tile[GEMM_MR * GEMM_NR_FLOAT];
+  for (int r = 0; r != GEMM_MR; ++r) {
+    _mm512_storeu_ps(tile + r * GEMM_NR_FLOAT, acc[r]);
+  }
+  gemm_store<float, GEMM_NR_FLOAT>(tile, alpha, c, ldc, mr, nr);
+}
+
+#endif
+
+SimdLevel simd_supported_level() {
+#ifdef S21_MATRIX_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) return SIMD_AVX512;
+  if (__builtin_cpu_supports("avx2")) return SIMD_AVX2;
+  if (__builtin_cpu_supports("sse2")) return SIMD_SSE2;
+#endif
+  return SIMD_SCALAR;
+}
+
+const SimdKernels& simd_kernels(SimdLevel level) {
+  static const SimdKernels kernels[] = {
+      {SIMD_SCALAR, add_scalar, sub_scalar, mul_number_scalar, equal_scalar, 4,
+       transpose_tile_scalar, batch_determinant_scalar, batch_inverse_scalar,
+       batch_multiply_scalar, gemm_micro_kernel<double>, add_float_scalar,
+       sub_float_scalar, mul_number_float_scalar, equal_float_scalar,
+       gemm_micro_kernel<float>},
+#ifdef S21_MATRIX_X86
+      {SIMD_SSE2, add_sse2, sub_sse2, mul_number_sse2, equal_sse2, 2,
+       transpose_tile_sse2, batch_determinant_sse2, batch_inverse_sse2,
+       batch_multiply_sse2, gemm_kernel_sse2, add_float_sse2, sub_float_sse2,
+       mul_number_float_sse2, equal_float_sse2, gemm_kernel_float_sse2},
+      {SIMD_AVX2, add_avx2, sub_avx2, mul_number_avx2, equal_avx2, 4,
+       transpose_tile_avx2, batch_determinant_avx2, batch_inverse_avx2,
+       batch_multiply_avx2, gemm_kernel_avx2, add_float_avx2, sub_float_avx2,
+       mul_number_float_avx2, equal_float_avx2, gemm_kernel_float_avx2},
+      {SIMD_AVX512, add_avx512, sub_avx512, mul_number_avx512, equal_avx512, 8,
+       transpose_tile_avx512, batch_determinant_avx512, batch_inverse_avx512,
+       batch_multiply_avx512, gemm_kernel_avx512, add_float_avx512,
+       sub_float_avx512, mul_number_float_avx512, equal_float_avx512,
+       gemm_kernel_float_avx512},
+#endif
+  };
+
+  return kernels[std::min(level, simd_supported_level())];
+}
+
+SimdLevel simd_requested_level() {
+  const char* names[] = {"scalar", "sse2", "avx2", "avx512"};
+  const char* env = std::getenv("S21_MATRIX_SIMD");
+
+  if (env != nullptr) {
+    for (int i = SIMD_SCALAR; i <= SIMD_AVX512; ++i) {
+      if (std::strcmp(env, names[i]) == 0) return static_cast<SimdLevel>(i);
+    }
+  }
+  return SIMD_AVX512;
+}
+
+const SimdKernels& simd_kernels() {
+  static const SimdKernels& kernels = simd_kernels(simd_requested_level());
+  return kernels;
+}
+
+template void gemm(int, int, int, double, const double*, int, int,
+                   const double*, int, int, double, double*, int);
+template void gemm(int, int, int, float, const float*, int, int, const float*,
+                   int, int, float, float*, int);
+template void gemm(int, int, int, int64_t, const int64_t*, int, int,
+                   const int64_t*, int, int, int64_t, int64_t*, int);
+template void gemm(int, int, int, std::complex<double>,
+                   const std::complex<double>*, int, int,
+                   const std::complex<double>*, int, int, std::complex<double>,
+                   std::complex<double>*, int);
+
+template void flush_to_zero(double*, int, int, int, double);
+template void flush_to_zero(float*, int, int, int, double);
+template void flush_to_zero(int64_t*, int, int, int, double);
+template void flush_to_zero(std::complex<double>*, int, int, int, double);
+
+template void strassen(int, int, int, const double*, int, const double*, int,
+                       double*, int, int, double*);
+template void strassen(int, int, int, const float*, int, const float*, int,
+                       float*, int, int, float*);
+template void strassen(int, int, int, const int64_t*, int, const int64_t*, int,
+                       int64_t*, int, int, int64_t*);
+template void strassen(int, int, int, const std::complex<double>*, int,
+                       const std::complex<double>*, int, std::complex<double>*,
+                       int, int, std::complex<double>*);
+
+template void transpose(const double*, int, int, long, double*, long);
+template void transpose(const float*, int, int, long, float*, long);
+template void transpose(const int64_t*, int, int, long, int64_t*, long);
+template void transpose(const std::complex<double>*, int, int, long,
+                        std::complex<double>*, long);
+
+template void transpose_in_place(double*, int, long);
+template void transpose_in_place(float*, int, long);
+template void transpose_in_place(int64_t*, int, long);
+template void transpose_in_place(std::complex<double>*, int, long);
+
+template void transpose_cycles(double*, int, int);
+template void transpose_cycles(float*, int, int);
+template void transpose_cycles(int64_t*, int, int);
+template void transpose_cycles(std::complex<double>*, int, int);
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <complex>
+#include <cstdint>
+
+#define GEMM_MR 4
+#define GEMM_NR 8
+#define GEMM_NR_FLOAT 16
+#define GEMM_MC 96
+#define GEMM_KC 256
+#define GEMM_NC 2048
+#define GEMM_SMALL 32768
+#define GEMM_TILE_M 192
+#define GEMM_TILE_N 512
+#define GEMM_PARALLEL_MIN 2097152
+#define PARALLEL_GRAIN 32768
+#define TRANSPOSE_BLOCK 32
+#define TRANSPOSE_PANEL 256
+#define BATCH_BLOCK 512
+#define BATCH_LANES 8
+#define LU_BLOCK 32
+#define CHOLESKY_BLOCK 32
+#define QR_BLOCK 32
+#define EXPR_CHUNK 256
+
+enum SimdLevel { SIMD_SCALAR, SIMD_SSE2, SIMD_AVX2, SIMD_AVX512 };
+
+struct SimdKernels {
+  SimdLevel level;
+  void (*add)(double* a, const double* b, long size);
+  void (*sub)(double* a, const double* b, long size);
+  void (*mul_number)(double* a, long size, double number, double precision);
+  bool (*equal)(const double* a, const double* b, long size,
+                double precision);
+  int tile;
+  void (*transpose_tile)(const double* a, long lda, double* b, long ldb);
+  void (*batch_determinant)(const double* a, int size, long count,
+                            long stride, double* det);
+  void (*batch_inverse)(const double* a, int size, long count, long stride,
+                        double* b, double* det);
+  void (*batch_multiply)(const double* a, const double* b, int m, int n, int k,
+                         long count, long stride, double* c,
+                         double precision);
+  void (*gemm_kernel)(int kc, double alpha, const double* a, const double* b,
+                      double* c, int ldc, int mr, int nr);
+  void (*add_float)(float* a, const float* b, long size);
+  void (*sub_float)(float* a, const float* b, long size);
+  void (*mul_number_float)(float* a, long size, float number, float precision);
+  bool (*equal_float)(const float* a, const float* b, long size,
+                      float precision);
+  void (*gemm_kernel_float)(int kc, float alpha, const float* a,
+                            const float* b, float* c, int ldc, int mr, int nr);
+};
+
+// Keeps alpha and beta out of template argument deduction, so literals like
+// gemm(..., 1, a, ...) take the element type of the matrices.
+template <typename T>
+struct s21_scalar {
+  using type = T;
+};
+
+template <typename T>
+using s21_scalar_t = typename s21_scalar<T>::type;
+
+// The templates below are instantiated for double, float, int64_t and
+// std::complex<double>.
+template <typename T>
+void gemm(int m, int n, int k, s21_scalar_t<T> alpha, const T* a, int a_row,
+          int a_col, const T* b, int b_row, int b_col, s21_scalar_t<T> beta,
+          T* c, int ldc);
+
+template <typename T>
+void flush_to_zero(T* c, int rows, int cols, int ldc, double precision);
+
+long strassen_workspace(int m, int n, int k, int cutoff);
+template <typename T>
+void strassen(int m, int n, int k, const T* a, int lda, const T* b, int ldb,
+              T* c, int ldc, int cutoff, T* work);
+
+template <typename T>
+void transpose(const T* a, int rows, int cols, long lda, T* b, long ldb);
+template <typename T>
+void transpose_in_place(T* a, int size, long lda);
+template <typename T>
+void transpose_cycles(T* a, int rows, int cols);
+
+SimdLevel simd_supported_level();
+const SimdKernels& simd_kernels();
+const SimdKernels& simd_kernels(SimdLevel level);
@@ -0,0 +1,213 @@
+#include "s21_matrix_lu.h"
+
+#include "s21_basic_matrix.h"
+#include "s21_matrix_kernels.h"
+#include "s21_thread_pool.h"
+
+template <typename T>
+typename S21MatrixTraits<T>::Real norm_1(const BasicMatrixView<T>& a) {
+  using Real = typename S21MatrixTraits<T>::Real;
+  using std::abs;
+  std::vector<Real> sums(a.GetCols());
+
+  for (int i = 0; i != a.GetRows(); ++i) {
+    const T* row = a.RowPtr(i);
+    for (int j = 0; j != a.GetCols(); ++j) sums[j] += abs(row[j]);
+  }
+  return sums.empty() ? 0 : *std::max_element(sums.begin(), sums.end());
+}
+
+template <typename T>
+int lu_factor(T* a, int size, int* pivots) {
+  int sign = 1;
+
+  for (int begin = 0; begin < size; begin += LU_BLOCK) {
+    int end = std::min(begin + LU_BLOCK, size);
+    lu_panel(a, size, begin, end, pivots, sign);
+    if (end == size) break;
+
+    for (int i = begin + 1; i != end; ++i) {
+      T* row = a + static_cast<long>(i) * size;
+      for (int p = begin; p != i; ++p) {
+        const T* src = a + static_cast<long>(p) * size;
+        for (int j = end; j != size; ++j) row[j] -= row[p] * src[j];
+      }
+    }
+
+    gemm(size - end, size - end, end - begin, -1,
+         a + static_cast<long>(end) * size + begin, size, 1,
+         a + static_cast<long>(begin) * size + end, size, 1, 1,
+         a + static_cast<long>(end) * size + end, size);
+  }
+  return sign;
+}
+
+template <typename T>
+void lu_substitute(const T* a, int size, T* x, int cols, bool identity) {
+  for (int begin = 0; begin < size; begin += LU_BLOCK) {
+    int end = std::min(begin + LU_BLOCK, size);
+    if (begin != 0) {
+      gemm(end - begin, identity ? begin : cols, begin, -1,
+           a + static_cast<long>(begin) * size, size, 1, x, cols, 1, 1,
+           x + static_cast<long>(begin) * cols, cols);
+    }
+
+    for (int i = begin + 1; i != end; ++i) {
+      T* row = x + static_cast<long>(i) * cols;
+      for (int p = begin; p != i; ++p) {
+        T factor = a[static_cast<long>(i) * size + p];
+        const T* src = x + static_cast<long>(p) * cols;
+        int width = identity ? p + 1 : cols;
+        for (int j = 0; j != width; ++j) row[j] -= factor * src[j];
+      }
+    }
+  }
+
+  for (int end = size; end > 0; end -= LU_BLOCK) {
+    int begin = std::max(end - LU_BLOCK, 0);
+    if (end != size) {
+      gemm(end - begin, cols, size - end, -1,
+           a + static_cast<long>(begin) * size + end, size, 1,
+           x + static_cast<long>(end) * cols, cols, 1, 1,
+           x + static_cast<long>(begin) * cols, cols);
+    }
+
+    for (int i = end - 1; i >= begin; --i) {
+      T* row = x + static_cast<long>(i) * cols;
+      for (int p = i + 1; p != end; ++p) {
+        T factor = a[static_cast<long>(i) * size + p];
+        const T* src = x + static_cast<long>(p) * cols;
+        for (int j = 0; j != cols; ++j) row[j] -= factor * src[j];
+      }
+
+      T inv_diagonal = T(1) / a[static_cast<long>(i) * size + i];
+      for (int j = 0; j != cols; ++j) row[j] *= inv_diagonal;
+    }
+  }
+}
+
+template <typename T>
+void lu_inverse(const T* lu, int size, const int* pivots, T* res) {
+  std::fill(res, res + static_cast<long>(size) * size, T());
+  for (int k = 0; k != size; ++k) res[static_cast<long>(k) * size + k] = 1;
+  lu_substitute(lu, size, res, size, true);
+
+  for (int k = size - 1; k >= 0; --k) {
+    if (pivots[k] == k) continue;
+    for (int i = 0; i != size; ++i) {
+      std::swap(res[static_cast<long>(i) * size + k],
+                res[static_cast<long>(i) * size + pivots[k]]);
+    }
+  }
+}
+
+S21MatrixLu::S21MatrixLu(const S21MatrixView& a)
+    : lu_(a), pivots_(a.GetRows()), sign_(1), singular_(false) {
+  if (a.GetRows() != a.GetCols())
+    throw std::logic_error("The matrix isn't squared");
+
+  int size = a.GetRows();
+  double tolerance = size * DBL_EPSILON * norm_1(a);
+  sign_ = lu_factor(lu_.Data(), size, pivots_.data());
+
+  for (int k = 0; k != size; ++k) {
+    if (fabs(lu_.AtUnchecked(k, k)) <= tolerance) singular_ = true;
+  }
+}
+
+std::vector<double> S21MatrixLu::Solve(const std::vector<double>& b) const {
+  int size = GetSize();
+  if (static_cast<long>(b.size()) != size)
+    throw std::logic_error(
+        "The required parameters of matrix have different sizes");
+  CheckSingular();
+
+  const double* a = lu_.Data();
+  std::vector<double> x(b);
+  for (int k = 0; k != size; ++k) std::swap(x[k], x[pivots_[k]]);
+
+  for (int i = 0; i != size; ++i) {
+    const double* row = a + static_cast<long>(i) * size;
+    double sum = x[i];
+    for (int p = 0; p != i; ++p) sum -= row[p] * x[p];
+    x[i] = sum;
+  }
+  for (int i = size - 1; i >= 0; --i) {
+    const double* row = a + static_cast<long>(i) * size;
+    double sum = x[i];
+    for (int p = i + 1; p != size; ++p) sum -= row[p] * x[p];
+    x[i] = sum / row[i];
+  }
+  return x;
+}
+
+S21Matrix S21MatrixLu::Solve(const S21MatrixView& b) const {
+  if (b.GetRows() != GetSize())
+    throw std::logic_error(
+        "The required parameters of matrix have different sizes");
+  CheckSingular();
+
+  S21Matrix x(b);
+  for (int k = 0; k != GetSize(); ++k) {
+    if (pivots_[k] == k) continue;
+    std::swap_ranges(x[k], x[k] + x.GetCols(), x[pivots_[k]]);
+  }
+  Substitute(x.Data(), x.GetCols(), false);
+  return x;
+}
+
+double S21MatrixLu::Determinant() const noexcept {
+  double res = sign_;
+  for (int k = 0; k != GetSize(); ++k) res *= lu_.AtUnchecked(k, k);
+  return res;
+}
+
+S21Matrix S21MatrixLu::Inverse() const {
+  CheckSingular();
+
+  S21Matrix res(GetSize(), GetSize(), S21Matrix::Uninitialized());
+  lu_inverse(lu_.Data(), GetSize(), pivots_.data(), res.Data());
+  return res;
+}
+
+bool S21MatrixLu::IsSingular() const noexcept { return singular_; }
+
+int S21MatrixLu::GetSize() const noexcept { return lu_.GetRows(); }
+
+const S21Matrix& S21MatrixLu::Packed() const noexcept { return lu_; }
+
+const std::vector<int>& S21MatrixLu::Pivots() const noexcept {
+  return pivots_;
+}
+
+void S21MatrixLu::CheckSingular() const {
+  if (singular_)
+    throw std::logic_error(
+        "The matrix is singular, the inverse matrix isn't exists");
+}
+
+void S21MatrixLu::Substitute(double* x, int cols, bool identity) const {
+  lu_substitute(lu_.Data(), GetSize(), x, cols, identity);
+}
+
+template <typename M>
+S21MatrixLu S21MatrixExtras<M, double>::Lu() const {
+  return S21MatrixLu(static_cast<const M&>(*this));
+}
+
+template S21MatrixLu S21MatrixExtras<S21Matrix, double>::Lu() const;
+template S21MatrixLu S21MatrixExtras<S21MatrixView, double>::Lu() const;
+
+template double norm_1(const S21MatrixView&);
+template float norm_1(const BasicMatrixView<float>&);
+template int64_t norm_1(const BasicMatrixView<int64_t>&);
+template double norm_1(const BasicMatrixView<std::complex<double>>&);
+
+template int lu_factor(double*, int, int*);
+template int lu_factor(float*, int, int*);
+template int lu_factor(std::complex<double>*, int, int*);
+
+template void lu_inverse(const double*, int, const int*, double*);
+template void lu_inverse(const float*, int, const int*, float*);
+template void lu_inverse(const std::complex<double>*, int, const int*,
+                         std::complex<double>*);
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <vector>
+
+#include "s21_matrix_oop.h"
+#include "s21_thread_pool.h"
+
+class S21MatrixLu {
+ public:
+  explicit S21MatrixLu(const S21MatrixView& a);
+
+  std::vector<double> Solve(const std::vector<double>& b) const;
+  S21Matrix Solve(const S21MatrixView& b) const;
+  double Determinant() const noexcept;
+  S21Matrix Inverse() const;
+
+  bool IsSingular() const noexcept;
+  int GetSize() const noexcept;
+  const S21Matrix& Packed() const noexcept;
+  const std::vector<int>& Pivots() const noexcept;
+
+ private:
+  void CheckSingular() const;
+  void Substitute(double* x, int cols, bool identity) const;
+
+  S21Matrix lu_;
+  std::vector<int> pivots_;
+  int sign_;
+  bool singular_;
+};
+
+// The templates below are instantiated for double, float and
+// std::complex<double>, norm_1 also for int64_t.
+template <typename T>
+typename S21MatrixTraits<T>::Real norm_1(const BasicMatrixView<T>& a);
+
+// Blocked LU with partial pivoting of a packed size x size matrix; returns
+// the sign of the row permutation.
+template <typename T>
+int lu_factor(T* a, int size, int* pivots);
+
+// Solves L U X = B in place for the size x cols matrix B in x; identity
+// marks B as the identity, whose forward step only fills the lower triangle.
+template <typename T>
+void lu_substitute(const T* lu, int size, T* x, int cols, bool identity);
+
+// Writes the inverse of the factored matrix to the size x size res.
+template <typename T>
+void lu_inverse(const T* lu, int size, const int* pivots, T* res);
+
+template <typename T>
+void lu_panel(T* a, int size, int begin, int end, int* pivots, int& sign) {
+  using std::abs;
+
+  for (int k = begin; k != end; ++k) {
+    int pivot_row = k;
+    for (int i = k + 1; i != size; ++i) {
+      if (abs(a[static_cast<long>(i) * size + k]) >
+          abs(a[static_cast<long>(pivot_row) * size + k]))
+        pivot_row = i;
+    }
+
+    pivots[k] = pivot_row;
+    if (pivot_row != k) {
+      std::swap_ranges(a + static_cast<long>(k) * size,
+                       a + static_cast<long>(k + 1) * size,
+                       a + static_cast<long>(pivot_row) * size);
+      sign = -sign;
+    }
+
+    T* pivot = a + static_cast<long>(k) * size;
+    if (pivot[k] == T()) continue;
+
+    parallel_for(k + 1, size, PARALLEL_GRAIN / (end - k) + 1,
+                 [=](long first, long last) {
+                   for (long i = first; i != last; ++i) {
+                     T* row = a + i * size;
+                     row[k] /= pivot[k];
+                     if (row[k] == T()) continue;
+
+                     for (int j = k + 1; j != end; ++j) {
+                       row[j] -= row[k] * pivot[j];
+                     }
+                   }
+                 });
+  }
+}
@@ -1,360 +1,1156 @@
-#include "s21_matrix_oop.h"
-
-S21Matrix::S21Matrix() : rows_(0), cols_(0), matrix_(nullptr) {}
+#include <atomic>
+#include <charconv>
+#include <numeric>
+
+#include "s21_basic_matrix.h"
+
+#include "s21_matrix_kernels.h"
+#include "s21_matrix_lu.h"
+#include "s21_matrix_stats.h"
+#include "s21_matrix_text.h"
+#include "s21_thread_pool.h"
+
+template <typename T>
+BasicMatrix<T>::BasicMatrix()
+    : rows_(0),
+      cols_(0),
+      matrix_(nullptr),
+      allocator_(nullptr),
+      capacity_(0),
+      pending_cols_(0) {}
+
+template <typename T>
+BasicMatrix<T>::BasicMatrix(int rows) : BasicMatrix(rows, rows) {}
+
+template <typename T>
+BasicMatrix<T>::BasicMatrix(int rows, int cols)
+    : BasicMatrix(rows, cols, Uninitialized()) {
+  std::fill(matrix_, matrix_ + static_cast<long>(rows_) * cols_, T());
+}
 
-S21Matrix::S21Matrix(int rows) {
-  if (rows < 1)
+template <typename T>
+BasicMatrix<T>::BasicMatrix(int rows, int cols, Uninitialized)
+    : BasicMatrix() {
+  if (rows < 1 || cols < 1)
     throw std::invalid_argument("Sizes of rows or cols must be greater than 0");
 
-  rows_ = rows;
-  cols_ = rows;
-  matrix_ = new double[rows_ * cols_]();
+  Allocate(rows, cols);
 }
 
-S21Matrix::S21Matrix(int rows, int cols) {
+template <typename T>
+BasicMatrix<T>::BasicMatrix(T* data, int rows, int cols,
+                            const S21MatrixAllocator* owner)
+    : BasicMatrix() {
   if (rows < 1 || cols < 1)
     throw std::invalid_argument("Sizes of rows or cols must be greater than 0");
+  if (data == nullptr)
+    throw std::invalid_argument("The adopted buffer must not be null");
 
   rows_ = rows;
   cols_ = cols;
-  matrix_ = new double[rows_ * cols_]();
+  matrix_ = data;
+  allocator_ = owner;
+  capacity_ = static_cast<long>(rows) * cols;
+  if (owner != nullptr) S21_STATS_ALLOCATE(s21_allocator_size<T>(capacity_));
 }
 
-S21Matrix::S21Matrix(const S21Matrix& o) noexcept
-    : rows_(o.rows_), cols_(o.cols_), matrix_(new double[o.rows_ * o.cols_]()) {
-  std::copy(o.matrix_, o.matrix_ + rows_ * cols_, matrix_);
+template <typename T>
+BasicMatrix<T>::BasicMatrix(const BasicMatrixView<T>& o) : BasicMatrix() {
+  if (o.GetRows() == 0 || o.GetCols() == 0) return;
+
+  Allocate(o.GetRows(), o.GetCols());
+  BasicMatrixView<T>(*this).Assign(o);
+}
+
+template <typename T>
+BasicMatrix<T>::BasicMatrix(const BasicMatrix& o) : BasicMatrix() {
+  Allocate(o.rows_, o.cols_);
+  std::copy(o.matrix_, o.matrix_ + static_cast<long>(rows_) * cols_, matrix_);
 }
 
-S21Matrix& S21Matrix::operator=(const S21Matrix& o) {
+template <typename T>
+BasicMatrix<T>& BasicMatrix<T>::operator=(const BasicMatrix& o) {
   if (this == &o) return *this;
 
-  double* ptr = new double[o.rows_ * o.cols_]();
-  delete[] matrix_;
+  long size = static_cast<long>(o.rows_) * o.cols_;
+
+  if (size > capacity_) {
+    BasicMatrix temp(o);
+    return *this = std::move(temp);
+  }
 
   rows_ = o.rows_;
   cols_ = o.cols_;
-  matrix_ = ptr;
-  std::copy(o.matrix_, o.matrix_ + rows_ * cols_, matrix_);
+  pending_cols_ = 0;
+  std::copy(o.matrix_, o.matrix_ + size, matrix_);
   return *this;
 }
 
-S21Matrix::S21Matrix(S21Matrix&& o) noexcept
-    : rows_(o.rows_), cols_(o.cols_), matrix_(o.matrix_) {
+template <typename T>
+BasicMatrix<T>::BasicMatrix(BasicMatrix&& o) noexcept
+    : rows_(o.rows_),
+      cols_(o.cols_),
+      matrix_(o.matrix_),
+      allocator_(o.allocator_),
+      capacity_(o.capacity_),
+      pending_cols_(o.pending_cols_) {
   o.rows_ = 0;
   o.cols_ = 0;
   o.matrix_ = nullptr;
+  o.allocator_ = nullptr;
+  o.capacity_ = 0;
+  o.pending_cols_ = 0;
 }
 
-S21Matrix& S21Matrix::operator=(S21Matrix&& o) {
+template <typename T>
+BasicMatrix<T>& BasicMatrix<T>::operator=(BasicMatrix&& o) {
   if (this == &o) return *this;
 
-  delete[] matrix_;
+  Release();
 
   rows_ = o.rows_;
   cols_ = o.cols_;
   matrix_ = o.matrix_;
+  allocator_ = o.allocator_;
+  capacity_ = o.capacity_;
+  pending_cols_ = o.pending_cols_;
 
   o.rows_ = 0;
   o.cols_ = 0;
   o.matrix_ = nullptr;
+  o.allocator_ = nullptr;
+  o.capacity_ = 0;
+  o.pending_cols_ = 0;
   return *this;
 }
 
-S21Matrix::~S21Matrix() {
-  if (matrix_ != nullptr) {
-    delete[] matrix_;
-    matrix_ = nullptr;
-  }
+template <typename T>
+BasicMatrix<T>::~BasicMatrix() {
+  Release();
   rows_ = 0;
   cols_ = 0;
 }
 
-double& S21Matrix::operator()(int rows, int cols) const {
+template <typename T>
+T& BasicMatrix<T>::operator()(int rows, int cols) const {
+#ifndef S21_MATRIX_NO_BOUNDS_CHECK
   if (rows >= rows_ || cols >= cols_ || rows < 0 || cols < 0)
     throw std::out_of_range("Incorrect parametrs of Matrix");
+#endif
 
   return matrix_[rows * cols_ + cols];
 }
 
-double* S21Matrix::operator[](int rows) const {
+template <typename T>
+T* BasicMatrix<T>::operator[](int rows) const {
+#ifndef S21_MATRIX_NO_BOUNDS_CHECK
   if (rows >= rows_ || rows < 0)
     throw std::out_of_range("Incorrect parametrs of Matrix");
+#endif
 
   return matrix_ + rows * cols_;
 }
 
-int S21Matrix::GetRows() const noexcept { return rows_; }
+void S21MatrixBase::ForEachChunk(long count,
+                                 const std::function<void(long, long)>& body) {
+  parallel_for(0, count, PARALLEL_GRAIN / EXPR_CHUNK + 1, body);
+}
+
+template <typename T>
+int BasicMatrix<T>::GetRows() const noexcept {
+  return rows_;
+}
 
-int S21Matrix::GetCols() const noexcept { return cols_; }
+template <typename T>
+int BasicMatrix<T>::GetCols() const noexcept {
+  return cols_;
+}
 
-void S21Matrix::SetRows(int rows) {
+template <typename T>
+void BasicMatrix<T>::SetRows(int rows) {
   if (rows < 1)
     throw std::invalid_argument("The number of rows must be greater than 0");
+  if (cols_ == 0)
+    throw std::invalid_argument("Sizes of rows or cols must be greater than 0");
+
+  long size = static_cast<long>(rows_) * cols_;
+  if (rows > rows_) {
+    Grow(static_cast<long>(rows) * cols_);
+    std::fill(matrix_ + size, matrix_ + static_cast<long>(rows) * cols_, T());
+  }
+  rows_ = rows;
+}
 
-  S21Matrix temp(rows, cols_);
+template <typename T>
+void BasicMatrix<T>::SetCols(int cols) {
+  if (cols < 1)
+    throw std::invalid_argument("The number of cols must be greater than 0");
+  if (rows_ == 0)
+    throw std::invalid_argument("Sizes of rows or cols must be greater than 0");
 
-  for (int i = 0; i != rows; ++i) {
-    for (int j = 0; j != cols_; ++j) {
-      temp[i][j] = i < rows_ ? (*this)[i][j] : 0;
+  if (cols < cols_) {
+    for (int i = 1; i < rows_; ++i) {
+      const T* src = matrix_ + static_cast<long>(i) * cols_;
+      std::copy(src, src + cols, matrix_ + static_cast<long>(i) * cols);
+    }
+  } else if (cols > cols_) {
+    Grow(static_cast<long>(rows_) * cols);
+    for (int i = rows_ - 1; i >= 0; --i) {
+      T* row = matrix_ + static_cast<long>(i) * cols;
+      const T* src = matrix_ + static_cast<long>(i) * cols_;
+      std::copy_backward(src, src + cols_, row + cols_);
+      std::fill(row + cols_, row + cols, T());
     }
   }
+  cols_ = cols;
+}
 
-  *this = std::move(temp);
+template <typename T>
+long BasicMatrix<T>::GetCapacity() const noexcept {
+  return capacity_;
 }
 
-void S21Matrix::SetCols(int cols) {
-  if (cols < 1)
-    throw std::invalid_argument("The number of cols must be greater than 0");
+template <typename T>
+void BasicMatrix<T>::Reserve(int rows, int cols) {
+  if (rows < 1 || cols < 1)
+    throw std::invalid_argument("Sizes of rows or cols must be greater than 0");
 
-  S21Matrix temp(rows_, cols);
+  if (static_cast<long>(rows) * cols > capacity_)
+    Reallocate(static_cast<long>(rows) * cols);
+  if (rows_ == 0) pending_cols_ = cols;
+}
 
-  for (int i = 0; i != rows_; ++i) {
-    for (int j = 0; j != cols; ++j) {
-      temp[i][j] = j < cols_ ? (*this)[i][j] : 0;
-    }
+template <typename T>
+void BasicMatrix<T>::ShrinkToFit() {
+  long size = static_cast<long>(rows_) * cols_;
+
+  if (size == 0) {
+    Release();
+  } else if (size != capacity_) {
+    Reallocate(size);
   }
+}
 
-  *this = std::move(temp);
+template <typename T>
+void BasicMatrix<T>::AppendRow(const T* row) {
+  int cols = rows_ == 0 ? pending_cols_ : cols_;
+  if (cols == 0)
+    throw std::logic_error("The number of cols must be greater than 0");
+
+  long size = static_cast<long>(rows_) * cols;
+  Grow(size + cols);
+  std::copy(row, row + cols, matrix_ + size);
+  cols_ = cols;
+  pending_cols_ = 0;
+  ++rows_;
 }
 
-std::istream& operator>>(std::istream& in, S21Matrix& o) noexcept {
-  for (int i = 0; i != o.rows_ * o.cols_; ++i) {
-    in >> o.matrix_[i];
+template <typename T>
+std::istream& operator>>(std::istream& in, BasicMatrix<T>& o) {
+  long size = static_cast<long>(o.GetRows()) * o.GetCols();
+  for (long i = 0; i != size && in >> o.Data()[i]; ++i) {
   }
   return in;
 }
 
-std::ostream& operator<<(std::ostream& out, const S21Matrix& o) noexcept {
-  for (int i = 0; i != o.rows_; ++i) {
-    for (int j = 0; j != o.cols_; ++j) {
-      out << o.matrix_[i * o.cols_ + j] << " ";
-    }
-    out << "\n";
-  }
-  return out;
+char* format_value(char* first, char* last, double value) noexcept {
+  return format_double(first, last, value);
 }
 
-bool S21Matrix::EqMatrix(const S21Matrix& o) const noexcept {
-  if (rows_ != o.rows_ || cols_ != o.cols_) {
-    return false;
-  }
+char* format_value(char* first, char* last, float value) noexcept {
+  return std::to_chars(first, last, value).ptr;
+}
 
-  for (int i = 0; i != rows_; ++i) {
-    for (int j = 0; j != cols_; ++j) {
-      if (fabs((*this)[i][j] - o[i][j]) > PRECISION) {
-        return false;
-      }
-    }
-  }
-  return true;
+char* format_value(char* first, char* last, int64_t value) noexcept {
+  return std::to_chars(first, last, value).ptr;
 }
 
-bool S21Matrix::operator==(const S21Matrix& o) const noexcept {
-  return EqMatrix(o);
+char* format_value(char* first, char*, std::complex<double> value) noexcept {
+  *first++ = '(';
+  first = format_double(first, first + 30, value.real());
+  *first++ = ',';
+  first = format_double(first, first + 30, value.imag());
+  *first++ = ')';
+  return first;
 }
 
-void S21Matrix::SumMatrix(const S21Matrix& o) {
-  if (rows_ != o.rows_ || cols_ != o.cols_)
-    throw std::logic_error("Matrices have different size of parametrs");
+template <typename T>
+std::ostream& operator<<(std::ostream& out, const BasicMatrix<T>& o) {
+  std::string row;
+  char value[64];
 
-  for (int i = 0; i != rows_; ++i) {
-    for (int j = 0; j != cols_; ++j) {
-      (*this)[i][j] += o[i][j];
+  for (int i = 0; i != o.GetRows(); ++i) {
+    row.clear();
+    for (int j = 0; j != o.GetCols(); ++j) {
+      row.append(value, format_value(value, value + 63, o.AtUnchecked(i, j)));
+      row += ' ';
     }
+    row += '\n';
+    out << row;
   }
+  return out;
+}
+
+template <typename T>
+bool BasicMatrix<T>::EqMatrix(const BasicMatrixView<T>& o) const noexcept {
+  return BasicMatrixView<T>(*this).EqMatrix(o);
 }
 
-S21Matrix& S21Matrix::operator+=(const S21Matrix& o) {
+template <typename T>
+bool BasicMatrix<T>::operator==(const BasicMatrix& o) const noexcept {
+  return EqMatrix(o);
+}
+
+template <typename T>
+void BasicMatrix<T>::SumMatrix(const BasicMatrixView<T>& o) {
+  BasicMatrixView<T>(*this).SumMatrix(o);
+}
+
+template <typename T>
+BasicMatrix<T>& BasicMatrix<T>::operator+=(const BasicMatrixView<T>& o) {
   SumMatrix(o);
   return *this;
 }
 
-S21Matrix S21Matrix::operator+(const S21Matrix& o) const {
-  S21Matrix res(*this);
+template <typename T>
+void BasicMatrix<T>::SubMatrix(const BasicMatrixView<T>& o) {
+  BasicMatrixView<T>(*this).SubMatrix(o);
+}
 
-  res.SumMatrix(o);
+template <typename T>
+BasicMatrix<T>& BasicMatrix<T>::operator-=(const BasicMatrixView<T>& o) {
+  SubMatrix(o);
+  return *this;
+}
 
-  return res;
+template <typename T>
+void BasicMatrix<T>::MulNumber(const T o) noexcept {
+  BasicMatrixView<T>(*this).MulNumber(o);
 }
 
-void S21Matrix::SubMatrix(const S21Matrix& o) {
-  if (rows_ != o.rows_ || cols_ != o.cols_) {
-    throw std::logic_error("Matrices have different size of parametrs");
-  }
+template <typename T>
+BasicMatrix<T>& BasicMatrix<T>::operator*=(const T& o) noexcept {
+  this->MulNumber(o);
+  return *this;
+}
 
-  for (int i = 0; i != rows_; ++i) {
-    for (int j = 0; j != cols_; ++j) {
-      (*this)[i][j] -= o[i][j];
-    }
+template <typename T>
+void BasicMatrix<T>::MulMatrix(const BasicMatrixView<T>& o) {
+  *this = BasicMatrixView<T>(*this) * o;
+}
+
+template <typename T>
+void BasicMatrix<T>::MulMatrixStrassen(const BasicMatrixView<T>& o,
+                                       int cutoff) {
+  if (cols_ != o.GetRows() || o.GetCols() < 1) {
+    throw std::logic_error(
+        "The required parameters of matrix have different sizes");
   }
+  if (cutoff < 1)
+    throw std::invalid_argument("The Strassen cutoff must be greater than 0");
+
+  int cols = o.GetCols();
+  S21_STATS_SCOPE(S21_OP_MUL_STRASSEN, 2L * rows_ * cols * cols_);
+  BasicMatrix res(rows_, cols, Uninitialized());
+  std::vector<T> work(strassen_workspace(rows_, cols, cols_, cutoff));
+
+  strassen(rows_, cols, cols_, matrix_, cols_, o.Data(), o.GetStride(),
+           res.matrix_, cols, cutoff, work.data());
+  flush_to_zero(res.matrix_, rows_, cols, cols, Traits::tolerance);
+
+  *this = std::move(res);
 }
 
-S21Matrix& S21Matrix::operator-=(const S21Matrix& o) {
-  SubMatrix(o);
+template <typename T>
+BasicMatrix<T>& BasicMatrix<T>::operator*=(const BasicMatrixView<T>& o) {
+  this->MulMatrix(o);
   return *this;
 }
 
-S21Matrix S21Matrix::operator-(const S21Matrix& o) const {
-  S21Matrix res(*this);
+template <typename T>
+BasicMatrix<T> BasicMatrix<T>::operator*(const BasicMatrix& o) const {
+  return BasicMatrixView<T>(*this) * BasicMatrixView<T>(o);
+}
 
-  res.SubMatrix(o);
+template <typename T>
+bool overlaps(const BasicMatrixView<T>& l, const BasicMatrixView<T>& r) {
+  if (l.GetRows() == 0 || r.GetRows() == 0) return false;
 
-  return res;
+  const T* l_end = l.RowPtr(l.GetRows() - 1) + l.GetCols();
+  const T* r_end = r.RowPtr(r.GetRows() - 1) + r.GetCols();
+  return l.Data() < r_end && r.Data() < l_end;
+}
+
+template <typename T>
+void BasicMatrix<T>::Gemm(T alpha, const BasicMatrixView<T>& a, bool trans_a,
+                          const BasicMatrixView<T>& b, bool trans_b, T beta,
+                          const BasicMatrixView<T>& c) {
+  int m = trans_a ? a.GetCols() : a.GetRows();
+  int k = trans_a ? a.GetRows() : a.GetCols();
+  int n = trans_b ? b.GetRows() : b.GetCols();
+
+  if ((trans_b ? b.GetCols() : b.GetRows()) != k || c.GetRows() != m ||
+      c.GetCols() != n) {
+    throw std::logic_error(
+        "The required parameters of matrix have different sizes");
+  }
+  if (m == 0 || n == 0) return;
+
+  S21_STATS_SCOPE(S21_OP_MUL_MATRIX, 2L * m * n * k);
+  BasicMatrix a_copy, b_copy;
+  BasicMatrixView<T> l(a), r(b);
+  if (overlaps(l, c)) l = a_copy = BasicMatrix(a);
+  if (overlaps(r, c)) r = b_copy = BasicMatrix(b);
+
+  gemm(m, n, k, alpha, l.Data(), trans_a ? 1 : l.GetStride(),
+       trans_a ? l.GetStride() : 1, r.Data(), trans_b ? 1 : r.GetStride(),
+       trans_b ? r.GetStride() : 1, beta, c.Data(), c.GetStride());
+  flush_to_zero(c.Data(), m, n, c.GetStride(), Traits::tolerance);
 }
 
-void S21Matrix::MulNumber(const double o) noexcept {
-  for (int i = 0; i != rows_; ++i) {
-    for (int j = 0; j != cols_; ++j) {
-      (*this)[i][j] *= o;
+template <typename T>
+void BasicMatrix<T>::Gemv(T alpha, const BasicMatrixView<T>& a, bool trans_a,
+                          const std::vector<T>& x, T beta,
+                          std::vector<T>& y) {
+  int rows = a.GetRows(), cols = a.GetCols();
+
+  if (static_cast<long>(x.size()) != (trans_a ? rows : cols) ||
+      static_cast<long>(y.size()) != (trans_a ? cols : rows)) {
+    throw std::logic_error(
+        "The required parameters of matrix have different sizes");
+  }
+
+  S21_STATS_SCOPE(S21_OP_MUL_MATRIX, 2L * rows * cols);
+  std::vector<T> x_copy;
+  const T* in = x.data();
+  if (&x == &y) {
+    x_copy = x;
+    in = x_copy.data();
+  }
+  T* out = y.data();
+
+  if (!trans_a) {
+    parallel_for(0, rows, PARALLEL_GRAIN / (cols + 1) + 1,
+                 [=](long begin, long end) {
+                   for (long i = begin; i != end; ++i) {
+                     const T* row = a.RowPtr(i);
+                     T sum = T();
+                     for (int j = 0; j != cols; ++j) sum += row[j] * in[j];
+                     out[i] = Traits::Flush(
+                         alpha * sum + (beta == T() ? T() : beta * out[i]));
+                   }
+                 });
+    return;
+  }
+
+  parallel_for(0, cols, PARALLEL_GRAIN / (rows + 1) + 1,
+               [=](long begin, long end) {
+                 for (long j = begin; j != end; ++j) {
+                   out[j] = beta == T() ? T() : beta * out[j];
+                 }
+                 for (int i = 0; i != rows; ++i) {
+                   const T* row = a.RowPtr(i);
+                   T scale = alpha * in[i];
+                   for (long j = begin; j != end; ++j) out[j] += scale * row[j];
+                 }
+                 flush_to_zero(out + begin, 1, end - begin, 0,
+                               Traits::tolerance);
+               });
+}
+
+template <typename T>
+BasicMatrix<T> BasicMatrix<T>::Transpose() const noexcept {
+  return BasicMatrixView<T>(*this).Transpose();
+}
+
+template <typename T>
+void BasicMatrix<T>::TransposeInPlace() {
+  S21_STATS_SCOPE(S21_OP_TRANSPOSE, 0);
+  if (rows_ == cols_) {
+    transpose_in_place(matrix_, rows_, cols_);
+  } else {
+    transpose_cycles(matrix_, rows_, cols_);
+    std::swap(rows_, cols_);
+  }
+}
+
+template <typename T>
+BasicMatrixView<T> BasicMatrix<T>::Block(int row, int col, int rows,
+                                         int cols) const {
+  return BasicMatrixView<T>(*this).Block(row, col, rows, cols);
+}
 
-      if (fabs((*this)[i][j]) < PRECISION) {
-        (*this)[i][j] = 0;
+int get_sign(int& row, int& col) { return (row + col) % 2 == 0 ? 1 : -1; }
+
+template <typename T>
+void fill_matrix(const BasicMatrixView<T>& in, BasicMatrix<T>& out,
+                 const int& skip_row, const int& skip_col) {
+  int row = 0;
+
+  for (int i = 0; i != in.GetRows(); ++i) {
+    if (i != skip_row) {
+      int col = 0;
+
+      for (int j = 0; j != in.GetCols(); ++j) {
+        if (j != skip_col) {
+          out.AtUnchecked(row, col) = in.AtUnchecked(i, j);
+          ++col;
+        }
       }
+
+      ++row;
     }
   }
 }
 
-S21Matrix& S21Matrix::operator*=(const double& o) noexcept {
-  this->MulNumber(o);
-  return *this;
-}
+int64_t bareiss_step(int64_t pivot, int64_t a, int64_t b, int64_t c,
+                     int64_t prev) {
+  int64_t left, right, res;
+  if (__builtin_mul_overflow(pivot, a, &left) ||
+      __builtin_mul_overflow(b, c, &right) ||
+      __builtin_sub_overflow(left, right, &res))
+    throw std::overflow_error("Integer overflow in matrix operation");
 
-S21Matrix S21Matrix::operator*(const double& o) const noexcept {
-  S21Matrix res(*this);
+  return res / prev;
+}
 
-  res.MulNumber(o);
+int64_t checked_mul(int64_t a, int64_t b) {
+  int64_t res;
+  if (__builtin_mul_overflow(a, b, &res))
+    throw std::overflow_error("Integer overflow in matrix operation");
 
   return res;
 }
 
-S21Matrix operator*(const double& o1, const S21Matrix& o2) noexcept {
-  S21Matrix res(o2);
-  return res *= o1;
-}
+int64_t det_bareiss(int64_t* a, int size) {
+  int64_t res = 1;
+  for (int k = 0; k != size; ++k) {
+    int pivot_row = k;
+    for (int i = k + 1; i != size; ++i) {
+      if (std::abs(a[i * size + k]) > std::abs(a[pivot_row * size + k]))
+        pivot_row = i;
+    }
+    if (a[pivot_row * size + k] == 0) return 0;
 
-void S21Matrix::MulMatrix(const S21Matrix& o) {
-  if (cols_ != o.rows_ || o.cols_ < 1) {
-    throw std::logic_error(
-        "The required parameters of matrix have different sizes");
+    if (pivot_row != k) {
+      std::swap_ranges(a + k * size, a + (k + 1) * size, a + pivot_row * size);
+      res = -res;
+    }
+
+    int64_t prev = k == 0 ? 1 : a[(k - 1) * size + k - 1];
+    for (int i = k + 1; i != size; ++i) {
+      for (int j = k + 1; j != size; ++j) {
+        a[i * size + j] = bareiss_step(a[k * size + k], a[i * size + j],
+                                       a[i * size + k], a[k * size + j], prev);
+      }
+    }
   }
+  return res * a[size * size - 1];
+}
+
+// Fraction-free Gauss-Jordan elimination of [l | r] with full pivoting.
+// Leaves the last pivot on the diagonal of the first rank rows of l, maps
+// the columns of l back to the input through perm and the parity of the
+// swaps in sign; returns the rank.
+int gauss_jordan_bareiss(int64_t* l, int64_t* r, int size, int* perm,
+                         int& sign, int64_t& prev) {
+  std::iota(perm, perm + size, 0);
+  sign = 1;
+  prev = 1;
+
+  for (int k = 0; k != size; ++k) {
+    int pivot_row = k, pivot_col = k;
+    for (int i = k; i != size; ++i) {
+      for (int j = k; j != size; ++j) {
+        if (std::abs(l[i * size + j]) >
+            std::abs(l[pivot_row * size + pivot_col])) {
+          pivot_row = i;
+          pivot_col = j;
+        }
+      }
+    }
+    if (l[pivot_row * size + pivot_col] == 0) return k;
 
-  S21Matrix temp(rows_, o.cols_);
+    if (pivot_row != k) {
+      std::swap_ranges(l + k * size, l + (k + 1) * size, l + pivot_row * size);
+      std::swap_ranges(r + k * size, r + (k + 1) * size, r + pivot_row * size);
+      sign = -sign;
+    }
+    if (pivot_col != k) {
+      for (int i = 0; i != size; ++i) {
+        std::swap(l[i * size + k], l[i * size + pivot_col]);
+      }
+      std::swap(perm[k], perm[pivot_col]);
+      sign = -sign;
+    }
 
-  for (int i = 0; i != rows_; ++i) {
-    for (int j = 0; j != o.cols_; ++j) {
-      for (int k = 0; k != cols_; ++k) {
-        temp[i][j] += (*this)[i][k] * o[k][j];
+    int64_t pivot = l[k * size + k];
+    for (int i = 0; i != size; ++i) {
+      if (i == k) continue;
 
-        if (fabs(temp[i][j]) < PRECISION) {
-          temp[i][j] = 0;
+      int64_t factor = l[i * size + k];
+      for (int j = 0; j != size; ++j) {
+        if (j != k) {
+          l[i * size + j] = bareiss_step(pivot, l[i * size + j], factor,
+                                         l[k * size + j], prev);
         }
+        r[i * size + j] = bareiss_step(pivot, r[i * size + j], factor,
+                                       r[k * size + j], prev);
       }
+      l[i * size + k] = 0;
     }
+    prev = pivot;
   }
+  return size;
+}
 
-  *this = std::move(temp);
+void make_primitive(std::vector<int64_t>& v) {
+  int64_t divisor = 0;
+  for (int64_t x : v) divisor = std::gcd(divisor, x);
+  for (int64_t& x : v) x /= divisor;
 }
 
-S21Matrix& S21Matrix::operator*=(const S21Matrix& o) {
-  this->MulMatrix(o);
-  return *this;
+void inverse_exact(const BasicMatrixView<int64_t>& in, int64_t* out) {
+  int size = in.GetRows();
+  S21MatrixInt64 l(in), r(size);
+  std::vector<int> perm(size);
+  int sign;
+  int64_t prev;
+  for (int k = 0; k != size; ++k) r.AtUnchecked(k, k) = 1;
+
+  if (gauss_jordan_bareiss(l.Data(), r.Data(), size, perm.data(), sign,
+                           prev) != size) {
+    throw std::logic_error(
+        "The matrix is singular, the inverse matrix isn't exists");
+  }
+
+  for (int k = 0; k != size; ++k) {
+    for (int j = 0; j != size; ++j) {
+      if (r.AtUnchecked(k, j) % prev != 0)
+        throw std::logic_error("The inverse matrix isn't an integer matrix");
+      out[static_cast<long>(perm[k]) * size + j] = r.AtUnchecked(k, j) / prev;
+    }
+  }
 }
 
-S21Matrix S21Matrix::operator*(const S21Matrix& o) const {
-  S21Matrix res(*this);
+// The adjugate of a matrix of rank size - 1 is c v u^T for the null vectors
+// A v = 0 and u^T A = 0; c comes from a single cofactor.
+void complements_exact(const BasicMatrixView<int64_t>& in, int64_t* out) {
+  int size = in.GetRows();
+  int last = size - 1;
+  S21MatrixInt64 l(in), r(size);
+  std::vector<int> perm(size);
+  int sign;
+  int64_t prev;
+  for (int k = 0; k != size; ++k) r.AtUnchecked(k, k) = 1;
+
+  int rank =
+      gauss_jordan_bareiss(l.Data(), r.Data(), size, perm.data(), sign, prev);
+
+  if (rank == size) {
+    for (int k = 0; k != size; ++k) {
+      for (int j = 0; j != size; ++j) {
+        out[static_cast<long>(j) * size + perm[k]] =
+            checked_mul(sign, r.AtUnchecked(k, j));
+      }
+    }
+  } else if (rank == last) {
+    std::vector<int64_t> right(size);
+    std::vector<int64_t> left(r.RowPtr(last), r.RowPtr(last) + size);
+    for (int k = 0; k != last; ++k) right[perm[k]] = -l.AtUnchecked(k, last);
+    right[perm[last]] = prev;
+    make_primitive(right);
+    make_primitive(left);
+
+    int row = std::find_if(left.begin(), left.end(),
+                           [](int64_t x) { return x != 0; }) -
+              left.begin();
+    int col = std::find_if(right.begin(), right.end(),
+                           [](int64_t x) { return x != 0; }) -
+              right.begin();
+
+    S21MatrixInt64 minor(last);
+    fill_matrix(in, minor, row, col);
+    int64_t scale = checked_mul(get_sign(row, col), minor.Determinant()) /
+                    checked_mul(left[row], right[col]);
+
+    for (int i = 0; i != size; ++i) {
+      for (int j = 0; j != size; ++j) {
+        out[static_cast<long>(i) * size + j] =
+            checked_mul(checked_mul(scale, left[i]), right[j]);
+      }
+    }
+  }
+}
 
-  res.MulMatrix(o);
+template <typename T>
+T det_closed_form(const T* a, int size) {
+  if (size == 1) return a[0];
 
-  return res;
+  if (size == 2) return a[0] * a[3] - a[1] * a[2];
+
+  if (size == 3) {
+    return a[0] * (a[4] * a[8] - a[5] * a[7]) -
+           a[1] * (a[3] * a[8] - a[5] * a[6]) +
+           a[2] * (a[3] * a[7] - a[4] * a[6]);
+  }
+
+  T s0 = a[0] * a[5] - a[1] * a[4];
+  T s1 = a[0] * a[6] - a[2] * a[4];
+  T s2 = a[0] * a[7] - a[3] * a[4];
+  T s3 = a[1] * a[6] - a[2] * a[5];
+  T s4 = a[1] * a[7] - a[3] * a[5];
+  T s5 = a[2] * a[7] - a[3] * a[6];
+
+  T c5 = a[10] * a[15] - a[11] * a[14];
+  T c4 = a[9] * a[15] - a[11] * a[13];
+  T c3 = a[9] * a[14] - a[10] * a[13];
+  T c2 = a[8] * a[15] - a[11] * a[12];
+  T c1 = a[8] * a[14] - a[10] * a[12];
+  T c0 = a[8] * a[13] - a[9] * a[12];
+
+  return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
 }
 
-S21Matrix S21Matrix::Transpose() const noexcept {
-  S21Matrix res(cols_, rows_);
+template <typename T>
+T det(const BasicMatrixView<T>& in) {
+  int size = in.GetRows();
 
-  for (int i = 0; i != rows_; ++i) {
-    for (int j = 0; j != cols_; ++j) {
-      res[j][i] = (*this)[i][j];
+  if (size == 0) return 1;
+
+  if constexpr (S21MatrixTraits<T>::exact) {
+    BasicMatrix<T> a(in);
+    return det_bareiss(a.Data(), size);
+  } else {
+    if (size <= DET_CLOSED_FORM_MAX) {
+      T a[DET_CLOSED_FORM_MAX * DET_CLOSED_FORM_MAX];
+      for (int i = 0; i != size; ++i) {
+        std::copy(in.RowPtr(i), in.RowPtr(i) + size, a + i * size);
+      }
+      return det_closed_form(a, size);
     }
+
+    BasicMatrix<T> lu(in);
+    std::vector<int> pivots(size);
+    T res = static_cast<T>(lu_factor(lu.Data(), size, pivots.data()));
+    for (int k = 0; k != size; ++k) res *= lu.AtUnchecked(k, k);
+    return res;
   }
-  return res;
 }
 
-int get_sign(int& row, int& col) { return (row + col) % 2 == 0 ? 1 : -1; }
+template <typename T>
+int lu_full_pivot(T* a, int size, int* row_perm, int* col_perm,
+                  typename S21MatrixTraits<T>::Real tolerance) {
+  using std::abs;
 
-void fill_matrix(const S21Matrix& in, S21Matrix& out, const int& skip_row,
-                 const int& skip_col) {
-  int row = 0;
-
-  for (int i = 0; i != in.GetRows(); ++i) {
-    if (i != skip_row) {
-      int col = 0;
+  for (int k = 0; k != size; ++k) {
+    row_perm[k] = k;
+    col_perm[k] = k;
+  }
 
-      for (int j = 0; j != in.GetCols(); ++j) {
-        if (j != skip_col) {
-          out[row][col] = in[i][j];
-          ++col;
+  for (int k = 0; k != size; ++k) {
+    int pivot_row = k, pivot_col = k;
+    for (int i = k; i != size; ++i) {
+      for (int j = k; j != size; ++j) {
+        if (abs(a[i * size + j]) > abs(a[pivot_row * size + pivot_col])) {
+          pivot_row = i;
+          pivot_col = j;
         }
       }
+    }
 
-      ++row;
+    if (abs(a[pivot_row * size + pivot_col]) <= tolerance) return k;
+
+    row_perm[k] = pivot_row;
+    col_perm[k] = pivot_col;
+    std::swap_ranges(a + k * size, a + (k + 1) * size, a + pivot_row * size);
+    for (int i = 0; i != size; ++i) {
+      std::swap(a[i * size + k], a[i * size + pivot_col]);
     }
+
+    T* pivot = a + k * size;
+    parallel_for(k + 1, size, PARALLEL_GRAIN / (size - k) + 1,
+                 [=](long begin, long end) {
+                   for (long i = begin; i != end; ++i) {
+                     T* row = a + i * size;
+                     row[k] /= pivot[k];
+                     if (row[k] == T()) continue;
+
+                     for (int j = k + 1; j != size; ++j) {
+                       row[j] -= row[k] * pivot[j];
+                     }
+                   }
+                 });
   }
+  return size;
 }
 
-double det(const S21Matrix& in, int size) {
-  if (size == 1) {
-    return in[0][0];
+template <typename T>
+void complements_full_rank(const T* lu, int size, const int* row_perm,
+                           const int* col_perm, T* out) {
+  T det = 1;
+  for (int k = 0; k != size; ++k) {
+    det *= lu[k * size + k];
+    if (row_perm[k] != k) det = -det;
+    if (col_perm[k] != k) det = -det;
   }
 
-  double res = 0;
-  int row = 0;
+  long grain = PARALLEL_GRAIN / (static_cast<long>(size) * size) + 1;
+  parallel_for(0, size, grain, [=](long begin, long end) {
+    std::vector<T> column(size);
+
+    for (long c = begin; c != end; ++c) {
+      std::fill(column.begin(), column.end(), T());
+      column[c] = 1;
+      for (int k = 0; k != size; ++k) std::swap(column[k], column[row_perm[k]]);
+
+      for (int i = 0; i != size; ++i) {
+        for (int j = 0; j != i; ++j) column[i] -= lu[i * size + j] * column[j];
+      }
+      for (int i = size - 1; i >= 0; --i) {
+        for (int j = i + 1; j != size; ++j) {
+          column[i] -= lu[i * size + j] * column[j];
+        }
+        column[i] /= lu[i * size + i];
+      }
+      for (int k = size - 1; k >= 0; --k) {
+        std::swap(column[k], column[col_perm[k]]);
+      }
+
+      for (int i = 0; i != size; ++i) out[c * size + i] = det * column[i];
+    }
+  });
+}
+
+template <typename T>
+void complements_rank_one_less(const BasicMatrixView<T>& in, const T* lu,
+                               const int* row_perm, const int* col_perm,
+                               T* out) {
+  using std::abs;
+  int size = in.GetRows();
+  int last = size - 1;
+  std::vector<T> right(size), left(size);
+
+  right[last] = 1;
+  for (int i = last - 1; i >= 0; --i) {
+    right[i] = -lu[i * size + last];
+    for (int j = i + 1; j != last; ++j) right[i] -= lu[i * size + j] * right[j];
+    right[i] /= lu[i * size + i];
+  }
+  for (int k = size - 1; k >= 0; --k) std::swap(right[k], right[col_perm[k]]);
 
-  S21Matrix temp(size);
+  left[last] = 1;
+  for (int i = last - 1; i >= 0; --i) {
+    for (int j = i + 1; j != size; ++j) left[i] -= lu[j * size + i] * left[j];
+  }
+  for (int k = size - 1; k >= 0; --k) std::swap(left[k], left[row_perm[k]]);
+
+  auto smaller = [](const T& x, const T& y) { return abs(x) < abs(y); };
+  int row = std::max_element(left.begin(), left.end(), smaller) - left.begin();
+  int col =
+      std::max_element(right.begin(), right.end(), smaller) - right.begin();
+
+  BasicMatrix<T> minor(last);
+  fill_matrix(in, minor, row, col);
+  T scale = static_cast<T>(get_sign(row, col)) * det<T>(minor) /
+            (left[row] * right[col]);
 
   for (int i = 0; i != size; ++i) {
-    fill_matrix(in, temp, row, i);
-    res += get_sign(row, i) * in[row][i] * det(temp, temp.GetCols() - 1);
+    for (int j = 0; j != size; ++j) {
+      out[i * size + j] = scale * left[i] * right[j];
+    }
   }
+}
+
+template <typename T>
+BasicMatrix<T> BasicMatrix<T>::CalcComplements() const {
+  return BasicMatrixView<T>(*this).CalcComplements();
+}
+
+template <typename T>
+T BasicMatrix<T>::Determinant() const {
+  return BasicMatrixView<T>(*this).Determinant();
+}
+
+template <typename T>
+BasicMatrix<T> BasicMatrix<T>::InverseMatrix() const {
+  return BasicMatrixView<T>(*this).InverseMatrix();
+}
+
+template <typename T>
+BasicMatrix<T> BasicMatrix<T>::InverseMatrix(double& cond) const {
+  return BasicMatrixView<T>(*this).InverseMatrix(cond);
+}
+
+void S21MatrixBase::SetThreadCount(int count) {
+  S21ThreadPool::Instance().SetThreadCount(count);
+}
+
+int S21MatrixBase::GetThreadCount() noexcept {
+  return S21ThreadPool::Instance().GetThreadCount();
+}
+
+template <typename T>
+BasicMatrixView<T>::BasicMatrixView() noexcept
+    : data_(nullptr), rows_(0), cols_(0), stride_(0) {}
+
+template <typename T>
+BasicMatrixView<T>::BasicMatrixView(const BasicMatrix<T>& o) noexcept
+    : data_(o.matrix_), rows_(o.rows_), cols_(o.cols_), stride_(o.cols_) {}
+
+template <typename T>
+BasicMatrixView<T>::BasicMatrixView(T* data, int rows, int cols)
+    : BasicMatrixView(data, rows, cols, cols) {}
+
+template <typename T>
+BasicMatrixView<T>::BasicMatrixView(T* data, int rows, int cols, int stride)
+    : data_(data), rows_(rows), cols_(cols), stride_(stride) {
+  if (rows < 0 || cols < 0 || stride < cols)
+    throw std::invalid_argument("Incorrect sizes of matrix view");
+  if (data == nullptr && rows != 0 && cols != 0)
+    throw std::invalid_argument("The viewed buffer must not be null");
+}
+
+template <typename T>
+T& BasicMatrixView<T>::operator()(int row, int col) const {
+#ifndef S21_MATRIX_NO_BOUNDS_CHECK
+  if (row >= rows_ || col >= cols_ || row < 0 || col < 0)
+    throw std::out_of_range("Incorrect parametrs of Matrix");
+#endif
+
+  return data_[static_cast<long>(row) * stride_ + col];
+}
+
+template <typename T>
+T* BasicMatrixView<T>::operator[](int row) const {
+#ifndef S21_MATRIX_NO_BOUNDS_CHECK
+  if (row >= rows_ || row < 0)
+    throw std::out_of_range("Incorrect parametrs of Matrix");
+#endif
+
+  return data_ + static_cast<long>(row) * stride_;
+}
+
+template <typename T>
+int BasicMatrixView<T>::GetRows() const noexcept {
+  return rows_;
+}
+
+template <typename T>
+int BasicMatrixView<T>::GetCols() const noexcept {
+  return cols_;
+}
+
+template <typename T>
+int BasicMatrixView<T>::GetStride() const noexcept {
+  return stride_;
+}
+
+template <typename T>
+T* BasicMatrixView<T>::Data() const noexcept {
+  return data_;
+}
+
+template <typename T>
+bool BasicMatrixView<T>::IsContiguous() const noexcept {
+  return stride_ == cols_ || rows_ <= 1;
+}
+
+template <typename T>
+BasicMatrixView<T> BasicMatrixView<T>::Block(int row, int col, int rows,
+                                             int cols) const {
+  if (row < 0 || col < 0 || rows < 0 || cols < 0 || row > rows_ - rows ||
+      col > cols_ - cols)
+    throw std::out_of_range("Incorrect parametrs of Matrix");
+
+  if (rows == 0 || cols == 0) return BasicMatrixView();
+
+  return BasicMatrixView(data_ + static_cast<long>(row) * stride_ + col, rows,
+                         cols, stride_);
+}
+
+template <typename T, typename Body>
+void for_each_span(const BasicMatrixView<T>& a, const BasicMatrixView<T>& b,
+                   Body body) {
+  if (a.GetRows() == 0 || a.GetCols() == 0) return;
+
+  if (a.IsContiguous() && b.IsContiguous()) {
+    parallel_for(0, static_cast<long>(a.GetRows()) * a.GetCols(),
+                 PARALLEL_GRAIN, [&](long begin, long end) {
+                   body(a.Data() + begin, b.Data() + begin, end - begin);
+                 });
+    return;
+  }
+
+  parallel_for(0, a.GetRows(), PARALLEL_GRAIN / a.GetCols() + 1,
+               [&](long begin, long end) {
+                 for (long i = begin; i != end; ++i) {
+                   body(a.Data() + i * a.GetStride(),
+                        b.Data() + i * b.GetStride(), a.GetCols());
+                 }
+               });
+}
+
+template <typename T>
+bool BasicMatrixView<T>::EqMatrix(const BasicMatrixView& o) const noexcept {
+  if (rows_ != o.rows_ || cols_ != o.cols_) {
+    return false;
+  }
+
+  S21_STATS_SCOPE(S21_OP_EQUAL, static_cast<long>(rows_) * cols_);
+  std::atomic<bool> equal(true);
+  for_each_span(*this, o, [&](const T* a, const T* b, long size) {
+    if (equal && !S21MatrixTraits<T>::Equal(a, b, size)) equal = false;
+  });
+  return equal;
+}
+
+template <typename T>
+bool BasicMatrixView<T>::operator==(const BasicMatrixView& o) const noexcept {
+  return EqMatrix(o);
+}
+
+template <typename T>
+void BasicMatrixView<T>::SumMatrix(const BasicMatrixView& o) const {
+  if (rows_ != o.rows_ || cols_ != o.cols_)
+    throw std::logic_error("Matrices have different size of parametrs");
+
+  S21_STATS_SCOPE(S21_OP_SUM, static_cast<long>(rows_) * cols_);
+  for_each_span(*this, o, [](T* a, const T* b, long size) {
+    S21MatrixTraits<T>::Add(a, b, size);
+  });
+}
+
+template <typename T>
+void BasicMatrixView<T>::SubMatrix(const BasicMatrixView& o) const {
+  if (rows_ != o.rows_ || cols_ != o.cols_)
+    throw std::logic_error("Matrices have different size of parametrs");
+
+  S21_STATS_SCOPE(S21_OP_SUB, static_cast<long>(rows_) * cols_);
+  for_each_span(*this, o, [](T* a, const T* b, long size) {
+    S21MatrixTraits<T>::Sub(a, b, size);
+  });
+}
+
+template <typename T>
+void BasicMatrixView<T>::MulNumber(const T o) const noexcept {
+  S21_STATS_SCOPE(S21_OP_MUL_NUMBER, static_cast<long>(rows_) * cols_);
+  for_each_span(*this, *this, [o](T* a, const T*, long size) {
+    S21MatrixTraits<T>::MulNumber(a, size, o);
+  });
+}
+
+template <typename T>
+void BasicMatrixView<T>::Assign(const BasicMatrixView& o) const {
+  if (rows_ != o.rows_ || cols_ != o.cols_)
+    throw std::logic_error("Matrices have different size of parametrs");
+
+  for_each_span(*this, o, [](T* a, const T* b, long size) {
+    std::copy(b, b + size, a);
+  });
+}
+
+template <typename T>
+BasicMatrix<T> BasicMatrixView<T>::Transpose() const {
+  if (rows_ == 0 || cols_ == 0) return BasicMatrix<T>();
+
+  S21_STATS_SCOPE(S21_OP_TRANSPOSE, 0);
+  BasicMatrix<T> res(cols_, rows_, typename BasicMatrix<T>::Uninitialized());
+  transpose(data_, rows_, cols_, stride_, res.Data(), rows_);
   return res;
 }
 
-S21Matrix S21Matrix::CalcComplements() const {
+template <typename T>
+BasicMatrix<T> BasicMatrixView<T>::CalcComplements() const {
+  using Real = typename S21MatrixTraits<T>::Real;
   if (rows_ != cols_) throw std::logic_error("The matrix isn't squared");
 
-  S21Matrix res(rows_);
+  S21_STATS_SCOPE(S21_OP_COMPLEMENTS, 8L * rows_ * rows_ * rows_ / 3);
+  BasicMatrix<T> res(rows_);
 
   if (rows_ == 1) {
-    res[0][0] = 1;
+    res.AtUnchecked(0, 0) = 1;
     return res;
   }
 
-  for (int i = 0; i != rows_; ++i) {
-    for (int j = 0; j != cols_; ++j) {
-      S21Matrix temp(rows_ - 1);
-      fill_matrix(*this, temp, i, j);
-      res[i][j] = get_sign(i, j) * det(temp, temp.GetCols());
+  if constexpr (S21MatrixTraits<T>::exact) {
+    complements_exact(*this, res.Data());
+  } else {
+    BasicMatrix<T> lu(*this);
+    std::vector<int> row_perm(rows_), col_perm(rows_);
+    Real tolerance = rows_ * std::numeric_limits<Real>::epsilon() *
+                     norm_1(*this);
+    int rank = lu_full_pivot(lu.Data(), rows_, row_perm.data(),
+                             col_perm.data(), tolerance);
+
+    if (rank == rows_) {
+      complements_full_rank(lu.Data(), rows_, row_perm.data(),
+                            col_perm.data(), res.Data());
+    } else if (rank == rows_ - 1) {
+      complements_rank_one_less(*this, lu.Data(), row_perm.data(),
+                                col_perm.data(), res.Data());
     }
   }
   return res;
 }
 
-double S21Matrix::Determinant() const {
+template <typename T>
+T BasicMatrixView<T>::Determinant() const {
   if (rows_ != cols_) {
     throw std::logic_error("The matrix isn't squared");
   }
 
-  return det(*this, rows_);
+  S21_STATS_SCOPE(S21_OP_DETERMINANT, 2L * rows_ * rows_ * rows_ / 3);
+  return det(*this);
 }
 
-S21Matrix S21Matrix::InverseMatrix() const {
-  double res_det = det(*this, rows_);
+template <typename T>
+BasicMatrix<T> BasicMatrixView<T>::InverseMatrix() const {
+  double cond = 0;
+  return InverseMatrix(cond);
+}
 
-  if (fabs(res_det) < PRECISION) {
-    throw std::logic_error(
-        "The determinant is 0, the inverse matrix isn't exists");
+template <typename T>
+BasicMatrix<T> BasicMatrixView<T>::InverseMatrix(double& cond) const {
+  using Real = typename S21MatrixTraits<T>::Real;
+  using std::abs;
+  if (rows_ != cols_) {
+    throw std::logic_error("The matrix isn't squared");
+  }
+
+  S21_STATS_SCOPE(S21_OP_INVERSE, 2L * rows_ * rows_ * rows_);
+  int size = rows_;
+  BasicMatrix<T> res(size, size, typename BasicMatrix<T>::Uninitialized());
+
+  if constexpr (S21MatrixTraits<T>::exact) {
+    inverse_exact(*this, res.Data());
+  } else {
+    BasicMatrix<T> lu(*this);
+    std::vector<int> pivots(size);
+    Real tolerance = size * std::numeric_limits<Real>::epsilon() *
+                     norm_1(*this);
+    lu_factor(lu.Data(), size, pivots.data());
+    for (int k = 0; k != size; ++k) {
+      if (abs(lu.AtUnchecked(k, k)) <= tolerance) {
+        throw std::logic_error(
+            "The matrix is singular, the inverse matrix isn't exists");
+      }
+    }
+    lu_inverse(lu.Data(), size, pivots.data(), res.Data());
   }
 
-  S21Matrix res(CalcComplements().Transpose());
-  res *= 1 / res_det;
+  cond = static_cast<double>(norm_1(*this)) *
+         static_cast<double>(norm_1<T>(res));
   return res;
 }
+
+#define S21_MATRIX_INSTANTIATE(T)                                         \
+  template class BasicMatrix<T>;                                          \
+  template class BasicMatrixView<T>;                                      \
+  template std::ostream& operator<<(std::ostream&, const BasicMatrix<T>&); \
+  template std::istream& operator>>(std::istream&, BasicMatrix<T>&);
+
+S21_MATRIX_INSTANTIATE(double)
+S21_MATRIX_INSTANTIATE(float)
+S21_MATRIX_INSTANTIATE(int64_t)
+S21_MATRIX_INSTANTIATE(std::complex<double>)
@@ -1,53 +1,861 @@
 #pragma once
 
+#include <algorithm>
+#include <cfloat>
 #include <cmath>
+#include <cstddef>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <string>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "s21_matrix_kernels.h"
 
 #define PRECISION 1e-7
+#define DET_CLOSED_FORM_MAX 4
+#define STRASSEN_CUTOFF 256
+#define S21_MATRIX_ALIGNMENT 64
+
+// Sizes are counted in doubles whatever the element type of the matrix.
+struct S21MatrixAllocator {
+  double* (*allocate)(long size);
+  void (*deallocate)(double* ptr, long size);
+};
+
+template <typename T>
+constexpr long s21_allocator_size(long size) noexcept {
+  return (size * static_cast<long>(sizeof(T)) + sizeof(double) - 1) /
+         sizeof(double);
+}
+
+enum S21MatrixOp {
+  S21_OP_EQUAL,
+  S21_OP_SUM,
+  S21_OP_SUB,
+  S21_OP_MUL_NUMBER,
+  S21_OP_MUL_MATRIX,
+  S21_OP_MUL_STRASSEN,
+  S21_OP_TRANSPOSE,
+  S21_OP_DETERMINANT,
+  S21_OP_COMPLEMENTS,
+  S21_OP_INVERSE,
+  S21_OP_COUNT
+};
+
+struct S21MatrixOpStats {
+  const char* name;
+  long calls;
+  long nanoseconds;
+  long flops;
+};
+
+struct S21MatrixStats {
+  S21MatrixOpStats ops[S21_OP_COUNT];
+  long allocations;
+  long bytes_allocated;
+  long live_bytes;
+  long peak_live_bytes;
+};
+
+template <typename E>
+class S21MatrixExpr;
+template <typename T>
+class S21MatrixRef;
+template <typename T>
+class BasicMatrix;
+template <typename T>
+class BasicMatrixView;
+class S21MatrixLu;
+class S21MatrixCholesky;
+class S21MatrixQr;
+using S21Matrix = BasicMatrix<double>;
+using S21MatrixView = BasicMatrixView<double>;
+
+// Per-type element behavior: Add/Sub/MulNumber/Equal work on spans of
+// values, Flush drops a single value below tolerance to zero.
+template <typename T>
+struct S21MatrixTraits;
+
+template <>
+struct S21MatrixTraits<double> {
+  using Real = double;
+  static constexpr bool exact = false;
+  static constexpr Real tolerance = PRECISION;
+
+  static void Add(double* a, const double* b, long size) noexcept {
+    simd_kernels().add(a, b, size);
+  }
+  static void Sub(double* a, const double* b, long size) noexcept {
+    simd_kernels().sub(a, b, size);
+  }
+  static void MulNumber(double* a, long size, double number) noexcept {
+    simd_kernels().mul_number(a, size, number, tolerance);
+  }
+  static bool Equal(const double* a, const double* b, long size) noexcept {
+    return simd_kernels().equal(a, b, size, tolerance);
+  }
+  static double Flush(double value) noexcept {
+    return std::fabs(value) < tolerance ? 0 : value;
+  }
+};
+
+template <typename T>
+class S21MatrixRowIterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = T*;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T* const*;
+  using reference = T*;
+
+  S21MatrixRowIterator() noexcept : row_(nullptr), stride_(0) {}
+  S21MatrixRowIterator(T* row, long stride) noexcept
+      : row_(row), stride_(stride) {}
+
+  T* operator*() const noexcept { return row_; }
+  T* operator[](difference_type n) const noexcept {
+    return row_ + n * stride_;
+  }
+
+  S21MatrixRowIterator& operator++() noexcept { return *this += 1; }
+  S21MatrixRowIterator& operator--() noexcept { return *this -= 1; }
+  S21MatrixRowIterator operator++(int) noexcept {
+    S21MatrixRowIterator res(*this);
+    *this += 1;
+    return res;
+  }
+  S21MatrixRowIterator operator--(int) noexcept {
+    S21MatrixRowIterator res(*this);
+    *this -= 1;
+    return res;
+  }
+
+  S21MatrixRowIterator& operator+=(difference_type n) noexcept {
+    row_ += n * stride_;
+    return *this;
+  }
+  S21MatrixRowIterator& operator-=(difference_type n) noexcept {
+    row_ -= n * stride_;
+    return *this;
+  }
+  S21MatrixRowIterator operator+(difference_type n) const noexcept {
+    return S21MatrixRowIterator(*this) += n;
+  }
+  S21MatrixRowIterator operator-(difference_type n) const noexcept {
+    return S21MatrixRowIterator(*this) -= n;
+  }
+  friend S21MatrixRowIterator operator+(difference_type n,
+                                        const S21MatrixRowIterator& it) {
+    return it + n;
+  }
+  difference_type operator-(const S21MatrixRowIterator& o) const noexcept {
+    return stride_ == 0 ? 0 : (row_ - o.row_) / stride_;
+  }
+
+  bool operator==(const S21MatrixRowIterator& o) const noexcept {
+    return row_ == o.row_;
+  }
+  bool operator!=(const S21MatrixRowIterator& o) const noexcept {
+    return row_ != o.row_;
+  }
+  bool operator<(const S21MatrixRowIterator& o) const noexcept {
+    return row_ < o.row_;
+  }
+  bool operator>(const S21MatrixRowIterator& o) const noexcept {
+    return row_ > o.row_;
+  }
+  bool operator<=(const S21MatrixRowIterator& o) const noexcept {
+    return row_ <= o.row_;
+  }
+  bool operator>=(const S21MatrixRowIterator& o) const noexcept {
+    return row_ >= o.row_;
+  }
+
+ private:
+  T* row_;
+  long stride_;
+};
+
+template <typename T>
+class S21MatrixRows {
+ public:
+  using iterator = S21MatrixRowIterator<T>;
+
+  S21MatrixRows(T* data, int rows, int stride) noexcept
+      : data_(data), rows_(rows), stride_(stride) {}
+
+  iterator begin() const noexcept { return iterator(data_, stride_); }
+  iterator end() const noexcept { return begin() + rows_; }
+  int size() const noexcept { return rows_; }
+
+ private:
+  T* data_;
+  int rows_, stride_;
+};
+
+class S21MatrixBase {
+ public:
+  static void SetThreadCount(int count);
+  static int GetThreadCount() noexcept;
+  static void SetAllocator(const S21MatrixAllocator& allocator);
+  static S21MatrixAllocator GetAllocator() noexcept;
+  static S21MatrixAllocator DefaultAllocator() noexcept;
+  static S21MatrixStats Stats() noexcept;
+  static void ResetStats() noexcept;
+  static void SetStatsExporter(void (*exporter)(const S21MatrixStats& stats));
+  static void ExportStats();
+
+ protected:
+  static void ForEachChunk(long count,
+                           const std::function<void(long, long)>& body);
+};
+
+// Members that only exist for some element types; M is the derived matrix
+// or view.
+template <typename M, typename T>
+class S21MatrixExtras {};
+
+template <typename M>
+class S21MatrixExtras<M, double> {
+ public:
+  S21MatrixLu Lu() const;
+  S21MatrixCholesky Cholesky() const;
+  S21MatrixQr Qr() const;
+};
+
+template <typename T>
+class BasicMatrix : public S21MatrixBase,
+                    public S21MatrixExtras<BasicMatrix<T>, T> {
+ public:
+  using Traits = S21MatrixTraits<T>;
+  struct Uninitialized {};
 
-class S21Matrix {
- public:
-  S21Matrix();
-  S21Matrix(int rows);
-  S21Matrix(int rows, int cols);
-  S21Matrix(const S21Matrix& o) noexcept;
-  S21Matrix(S21Matrix&& o) noexcept;
-  ~S21Matrix();
-
-  S21Matrix& operator=(const S21Matrix& o);
-  S21Matrix& operator=(S21Matrix&& o);
-  double& operator()(int row, int col) const;
-  double* operator[](int row) const;
-  bool operator==(const S21Matrix& o) const noexcept;
-  S21Matrix& operator+=(const S21Matrix& o);
-  S21Matrix operator+(const S21Matrix& o) const;
-  S21Matrix& operator-=(const S21Matrix& o);
-  S21Matrix operator-(const S21Matrix& o) const;
-  S21Matrix& operator*=(const double& o) noexcept;
-  S21Matrix operator*(const double& o) const noexcept;
-  S21Matrix& operator*=(const S21Matrix& o);
-  S21Matrix operator*(const S21Matrix& o) const;
-
-  bool EqMatrix(const S21Matrix& o) const noexcept;
-  void SumMatrix(const S21Matrix& o);
-  void SubMatrix(const S21Matrix& o);
-  void MulNumber(const double o) noexcept;
-  void MulMatrix(const S21Matrix& o);
-
-  S21Matrix Transpose() const noexcept;
-  S21Matrix CalcComplements() const;
-  double Determinant() const;
-  S21Matrix InverseMatrix() const;
+  BasicMatrix();
+  BasicMatrix(int rows);
+  BasicMatrix(int rows, int cols);
+  BasicMatrix(int rows, int cols, Uninitialized);
+  BasicMatrix(T* data, int rows, int cols,
+              const S21MatrixAllocator* owner = nullptr);
+  explicit BasicMatrix(const BasicMatrixView<T>& o);
+  template <typename U>
+  explicit BasicMatrix(const BasicMatrix<U>& o);
+  BasicMatrix(const BasicMatrix& o);
+  BasicMatrix(BasicMatrix&& o) noexcept;
+  template <typename E>
+  BasicMatrix(const S21MatrixExpr<E>& e);
+  ~BasicMatrix();
+
+  BasicMatrix& operator=(const BasicMatrix& o);
+  BasicMatrix& operator=(BasicMatrix&& o);
+  template <typename E>
+  BasicMatrix& operator=(const S21MatrixExpr<E>& e);
+  T& operator()(int row, int col) const;
+  T* operator[](int row) const;
+  bool operator==(const BasicMatrix& o) const noexcept;
+
+  T& AtUnchecked(int row, int col) noexcept {
+    return matrix_[static_cast<long>(row) * cols_ + col];
+  }
+  const T& AtUnchecked(int row, int col) const noexcept {
+    return matrix_[static_cast<long>(row) * cols_ + col];
+  }
+  T* Data() noexcept { return matrix_; }
+  const T* Data() const noexcept { return matrix_; }
+  T* RowPtr(int row) noexcept {
+    return matrix_ + static_cast<long>(row) * cols_;
+  }
+  const T* RowPtr(int row) const noexcept {
+    return matrix_ + static_cast<long>(row) * cols_;
+  }
+
+  T* begin() noexcept { return matrix_; }
+  T* end() noexcept { return matrix_ + static_cast<long>(rows_) * cols_; }
+  const T* begin() const noexcept { return matrix_; }
+  const T* end() const noexcept {
+    return matrix_ + static_cast<long>(rows_) * cols_;
+  }
+  S21MatrixRows<T> Rows() noexcept { return {matrix_, rows_, cols_}; }
+  S21MatrixRows<const T> Rows() const noexcept {
+    return {matrix_, rows_, cols_};
+  }
+
+  BasicMatrix& operator+=(const BasicMatrixView<T>& o);
+  template <typename E>
+  BasicMatrix& operator+=(const S21MatrixExpr<E>& e);
+  BasicMatrix& operator-=(const BasicMatrixView<T>& o);
+  template <typename E>
+  BasicMatrix& operator-=(const S21MatrixExpr<E>& e);
+  BasicMatrix& operator*=(const T& o) noexcept;
+  BasicMatrix& operator*=(const BasicMatrixView<T>& o);
+  template <typename E>
+  BasicMatrix& operator*=(const S21MatrixExpr<E>& e);
+  BasicMatrix operator*(const BasicMatrix& o) const;
+
+  bool EqMatrix(const BasicMatrixView<T>& o) const noexcept;
+  template <typename E>
+  bool EqMatrix(const S21MatrixExpr<E>& e) const;
+  void SumMatrix(const BasicMatrixView<T>& o);
+  template <typename E>
+  void SumMatrix(const S21MatrixExpr<E>& e);
+  void SubMatrix(const BasicMatrixView<T>& o);
+  template <typename E>
+  void SubMatrix(const S21MatrixExpr<E>& e);
+  void MulNumber(const T o) noexcept;
+  void MulMatrix(const BasicMatrixView<T>& o);
+  template <typename E>
+  void MulMatrix(const S21MatrixExpr<E>& e);
+  // Strassen-Winograd product; blocks with a side <= cutoff use MulMatrix's
+  // kernel. Only a normwise bound holds (Higham, Accuracy and Stability,
+  // 23.2.2): max|C - C'| <= ((n/n0)^log2(18) (n0^2 + 6 n0) - 6 n) u
+  // max|A| max|B| with n0 = cutoff, against n u |A||B| per element for
+  // MulMatrix, so small entries of C can lose all relative accuracy.
+  void MulMatrixStrassen(const BasicMatrixView<T>& o,
+                         int cutoff = STRASSEN_CUTOFF);
+
+  BasicMatrix Transpose() const noexcept;
+  void TransposeInPlace();
+  BasicMatrix CalcComplements() const;
+  T Determinant() const;
+  BasicMatrix InverseMatrix() const;
+  BasicMatrix InverseMatrix(double& cond) const;
+  BasicMatrixView<T> Block(int row, int col, int rows, int cols) const;
 
   int GetRows() const noexcept;
   int GetCols() const noexcept;
   void SetRows(int);
   void SetCols(int);
-  friend std::ostream& operator<<(std::ostream& out, const S21Matrix& o) noexcept;
-  friend std::istream& operator>>(std::istream& in, S21Matrix& o) noexcept;
-  friend S21Matrix operator*(const double& o1, const S21Matrix& o2) noexcept;
+  long GetCapacity() const noexcept;
+  void Reserve(int rows, int cols);
+  void ShrinkToFit();
+  void AppendRow(const T* row);
+
+  void Save(const std::string& path) const;
+  static BasicMatrix Load(const std::string& path);
+  static BasicMatrix Map(const std::string& path);
+
+  // C = alpha * op(A) * op(B) + beta * C, flushed like MulMatrix.
+  static void Gemm(T alpha, const BasicMatrixView<T>& a, bool trans_a,
+                   const BasicMatrixView<T>& b, bool trans_b, T beta,
+                   const BasicMatrixView<T>& c);
+  static void Gemv(T alpha, const BasicMatrixView<T>& a, bool trans_a,
+                   const std::vector<T>& x, T beta, std::vector<T>& y);
+
+  friend class BasicMatrixView<T>;
 
  private:
+  template <typename E>
+  void CheckSize(const S21MatrixExpr<E>& e) const;
+  template <typename E, typename Op>
+  void Apply(const E& expr, Op op);
+  void Allocate(int rows, int cols);
+  void Release() noexcept;
+  void Reallocate(long capacity);
+  void Grow(long size);
+
   int rows_, cols_;
-  double* matrix_;
-};
\ No newline at end of file
+  T* matrix_;
+  const S21MatrixAllocator* allocator_;
+  long capacity_;
+  int pending_cols_;
+};
+
+template <typename T>
+class BasicMatrixView : public S21MatrixExtras<BasicMatrixView<T>, T> {
+ public:
+  BasicMatrixView() noexcept;
+  BasicMatrixView(const BasicMatrix<T>& o) noexcept;
+  BasicMatrixView(T* data, int rows, int cols);
+  BasicMatrixView(T* data, int rows, int cols, int stride);
+
+  T& operator()(int row, int col) const;
+  T* operator[](int row) const;
+  bool operator==(const BasicMatrixView& o) const noexcept;
+
+  T& AtUnchecked(int row, int col) const noexcept {
+    return data_[static_cast<long>(row) * stride_ + col];
+  }
+  T* RowPtr(int row) const noexcept {
+    return data_ + static_cast<long>(row) * stride_;
+  }
+  S21MatrixRows<T> Rows() const noexcept { return {data_, rows_, stride_}; }
+
+  bool EqMatrix(const BasicMatrixView& o) const noexcept;
+  void SumMatrix(const BasicMatrixView& o) const;
+  void SubMatrix(const BasicMatrixView& o) const;
+  void MulNumber(const T o) const noexcept;
+  void Assign(const BasicMatrixView& o) const;
+
+  BasicMatrix<T> Transpose() const;
+  BasicMatrix<T> CalcComplements() const;
+  T Determinant() const;
+  BasicMatrix<T> InverseMatrix() const;
+  BasicMatrix<T> InverseMatrix(double& cond) const;
+  BasicMatrixView Block(int row, int col, int rows, int cols) const;
+
+  int GetRows() const noexcept;
+  int GetCols() const noexcept;
+  int GetStride() const noexcept;
+  T* Data() const noexcept;
+  bool IsContiguous() const noexcept;
+
+  friend BasicMatrix<T> operator*(const BasicMatrixView& l,
+                                  const BasicMatrixView& r) {
+    if (l.GetCols() != r.GetRows() || r.GetCols() < 1) {
+      throw std::logic_error(
+          "The required parameters of matrix have different sizes");
+    }
+
+    BasicMatrix<T> res(l.GetRows(), r.GetCols(),
+                       typename BasicMatrix<T>::Uninitialized());
+    BasicMatrix<T>::Gemm(1, l, false, r, false, 0, res);
+    return res;
+  }
+
+ private:
+  T* data_;
+  int rows_, cols_, stride_;
+};
+
+template <typename T>
+template <typename U>
+BasicMatrix<T>::BasicMatrix(const BasicMatrix<U>& o) : BasicMatrix() {
+  if (o.GetRows() == 0) return;
+
+  Allocate(o.GetRows(), o.GetCols());
+  std::transform(o.begin(), o.end(), matrix_,
+                 [](const U& value) { return static_cast<T>(value); });
+}
+
+template <typename T>
+struct s21_value {};
+
+template <typename T>
+using s21_value_t = typename s21_value<T>::type;
+
+// Lazy result of +, - and scalar *. Evaluates into a BasicMatrix on
+// assignment, or through Eval() and the forwarding members below.
+// Row(row, col, count, out, work) returns count values starting at
+// (row, col), either straight from an operand or written to out, using
+// kBuffers * count values of work for intermediate results.
+template <typename E>
+class S21MatrixExpr {
+ public:
+  const E& Self() const noexcept { return static_cast<const E&>(*this); }
+  int GetRows() const noexcept { return Self().GetRows(); }
+  int GetCols() const noexcept { return Self().GetCols(); }
+  auto At(int row, int col) const noexcept { return Self().At(row, col); }
+
+  auto operator()(int row, int col) const {
+#ifndef S21_MATRIX_NO_BOUNDS_CHECK
+    if (row >= GetRows() || col >= GetCols() || row < 0 || col < 0)
+      throw std::out_of_range("Incorrect parametrs of Matrix");
+#endif
+
+    return At(row, col);
+  }
+
+  auto Eval() const { return BasicMatrix<s21_value_t<E>>(*this); }
+  auto Transpose() const {
+    auto res = Eval();
+    res.TransposeInPlace();
+    return res;
+  }
+  auto CalcComplements() const { return Eval().CalcComplements(); }
+  auto Determinant() const { return Eval().Determinant(); }
+  auto InverseMatrix() const { return Eval().InverseMatrix(); }
+};
+
+template <typename T>
+class S21MatrixRef : public S21MatrixExpr<S21MatrixRef<T>> {
+ public:
+  S21MatrixRef(const BasicMatrix<T>& o) noexcept
+      : data_(o.Data()),
+        rows_(o.GetRows()),
+        cols_(o.GetCols()),
+        stride_(o.GetCols()) {}
+  S21MatrixRef(const BasicMatrixView<T>& o) noexcept
+      : data_(o.Data()),
+        rows_(o.GetRows()),
+        cols_(o.GetCols()),
+        stride_(o.GetStride()) {}
+
+  static constexpr int kBuffers = 0;
+
+  int GetRows() const noexcept { return rows_; }
+  int GetCols() const noexcept { return cols_; }
+  bool IsContiguous() const noexcept { return stride_ == cols_ || rows_ <= 1; }
+  bool Overlaps(const T* begin, const T* end) const noexcept {
+    return rows_ != 0 && cols_ != 0 && data_ < end &&
+           begin < data_ + static_cast<long>(rows_ - 1) * stride_ + cols_;
+  }
+  T At(int row, int col) const noexcept {
+    return data_[static_cast<long>(row) * stride_ + col];
+  }
+  const T* Row(int row, long col, int, T*, T*) const noexcept {
+    return data_ + static_cast<long>(row) * stride_ + col;
+  }
+
+ private:
+  const T* data_;
+  int rows_, cols_, stride_;
+};
+
+struct S21PlusOp {
+  template <typename T>
+  static T Apply(const T& a, const T& b) noexcept {
+    return a + b;
+  }
+  template <typename T>
+  static void Apply(T* a, const T* b, long size) noexcept {
+    S21MatrixTraits<T>::Add(a, b, size);
+  }
+};
+
+struct S21MinusOp {
+  template <typename T>
+  static T Apply(const T& a, const T& b) noexcept {
+    return a - b;
+  }
+  template <typename T>
+  static void Apply(T* a, const T* b, long size) noexcept {
+    S21MatrixTraits<T>::Sub(a, b, size);
+  }
+};
+
+template <typename L, typename R, typename Op>
+class S21MatrixBinaryExpr
+    : public S21MatrixExpr<S21MatrixBinaryExpr<L, R, Op>> {
+ public:
+  using T = s21_value_t<L>;
+
+  S21MatrixBinaryExpr(const L& l, const R& r) : l_(l), r_(r) {
+    if (l_.GetRows() != r_.GetRows() || l_.GetCols() != r_.GetCols())
+      throw std::logic_error("Matrices have different size of parametrs");
+  }
+
+  static constexpr int kBuffers = std::max(L::kBuffers, R::kBuffers + 1);
+
+  int GetRows() const noexcept { return l_.GetRows(); }
+  int GetCols() const noexcept { return l_.GetCols(); }
+  bool IsContiguous() const noexcept {
+    return l_.IsContiguous() && r_.IsContiguous();
+  }
+  bool Overlaps(const T* begin, const T* end) const noexcept {
+    return l_.Overlaps(begin, end) || r_.Overlaps(begin, end);
+  }
+  T At(int row, int col) const noexcept {
+    return Op::Apply(l_.At(row, col), r_.At(row, col));
+  }
+  const T* Row(int row, long col, int count, T* out, T* work) const noexcept {
+    const T* l = l_.Row(row, col, count, out, work);
+    const T* r = r_.Row(row, col, count, work, work + count);
+    if (l != out) std::copy(l, l + count, out);
+    Op::Apply(out, r, count);
+    return out;
+  }
+
+ private:
+  L l_;
+  R r_;
+};
+
+template <typename E>
+class S21MatrixScaleExpr : public S21MatrixExpr<S21MatrixScaleExpr<E>> {
+ public:
+  using T = s21_value_t<E>;
+
+  S21MatrixScaleExpr(const E& e, const T& number) noexcept
+      : e_(e), number_(number) {}
+
+  static constexpr int kBuffers = E::kBuffers;
+
+  int GetRows() const noexcept { return e_.GetRows(); }
+  int GetCols() const noexcept { return e_.GetCols(); }
+  bool IsContiguous() const noexcept { return e_.IsContiguous(); }
+  bool Overlaps(const T* begin, const T* end) const noexcept {
+    return e_.Overlaps(begin, end);
+  }
+  T At(int row, int col) const noexcept {
+    return S21MatrixTraits<T>::Flush(e_.At(row, col) * number_);
+  }
+  const T* Row(int row, long col, int count, T* out, T* work) const noexcept {
+    const T* e = e_.Row(row, col, count, out, work);
+    if (e != out) std::copy(e, e + count, out);
+    S21MatrixTraits<T>::MulNumber(out, count, number_);
+    return out;
+  }
+
+ private:
+  E e_;
+  T number_;
+};
+
+template <typename T>
+struct s21_value<BasicMatrix<T>> {
+  using type = T;
+};
+
+template <typename T>
+struct s21_value<BasicMatrixView<T>> {
+  using type = T;
+};
+
+template <typename T>
+struct s21_value<S21MatrixRef<T>> {
+  using type = T;
+};
+
+template <typename L, typename R, typename Op>
+struct s21_value<S21MatrixBinaryExpr<L, R, Op>> {
+  using type = s21_value_t<L>;
+};
+
+template <typename E>
+struct s21_value<S21MatrixScaleExpr<E>> {
+  using type = s21_value_t<E>;
+};
+
+template <typename T, typename = void>
+constexpr bool is_s21_operand_v = false;
+
+template <typename T>
+constexpr bool is_s21_operand_v<T, std::void_t<s21_value_t<T>>> = true;
+
+template <typename L, typename R, typename = void>
+constexpr bool is_s21_pair_v = false;
+
+template <typename L, typename R>
+constexpr bool is_s21_pair_v<
+    L, R, std::enable_if_t<std::is_same_v<s21_value_t<L>, s21_value_t<R>>>> =
+    true;
+
+template <typename T>
+using s21_operand_t = std::conditional_t<
+    std::is_same_v<T, BasicMatrix<s21_value_t<T>>> ||
+        std::is_same_v<T, BasicMatrixView<s21_value_t<T>>>,
+    S21MatrixRef<s21_value_t<T>>, T>;
+
+template <typename L, typename R,
+          typename = std::enable_if_t<is_s21_pair_v<L, R>>>
+S21MatrixBinaryExpr<s21_operand_t<L>, s21_operand_t<R>, S21PlusOp> operator+(
+    const L& l, const R& r) {
+  return {l, r};
+}
+
+template <typename L, typename R,
+          typename = std::enable_if_t<is_s21_pair_v<L, R>>>
+S21MatrixBinaryExpr<s21_operand_t<L>, s21_operand_t<R>, S21MinusOp> operator-(
+    const L& l, const R& r) {
+  return {l, r};
+}
+
+template <typename E, typename = std::enable_if_t<is_s21_operand_v<E>>>
+S21MatrixScaleExpr<s21_operand_t<E>> operator*(const E& e,
+                                               s21_value_t<E> number) {
+  return {e, number};
+}
+
+template <typename E, typename = std::enable_if_t<is_s21_operand_v<E>>>
+S21MatrixScaleExpr<s21_operand_t<E>> operator*(s21_value_t<E> number,
+                                               const E& e) {
+  return {e, number};
+}
+
+template <typename T, typename R,
+          typename = std::enable_if_t<is_s21_pair_v<BasicMatrix<T>, R>>>
+BasicMatrix<T> operator+(BasicMatrix<T>&& l, const R& r) {
+  l += r;
+  return std::move(l);
+}
+
+template <typename T, typename L,
+          typename = std::enable_if_t<is_s21_pair_v<L, BasicMatrix<T>>>>
+BasicMatrix<T> operator+(const L& l, BasicMatrix<T>&& r) {
+  r += l;
+  return std::move(r);
+}
+
+template <typename T>
+BasicMatrix<T> operator+(BasicMatrix<T>&& l, BasicMatrix<T>&& r) {
+  l += r;
+  return std::move(l);
+}
+
+template <typename T, typename R,
+          typename = std::enable_if_t<is_s21_pair_v<BasicMatrix<T>, R>>>
+BasicMatrix<T> operator-(BasicMatrix<T>&& l, const R& r) {
+  l -= r;
+  return std::move(l);
+}
+
+template <typename T, typename L,
+          typename = std::enable_if_t<is_s21_pair_v<L, BasicMatrix<T>>>>
+BasicMatrix<T> operator-(const L& l, BasicMatrix<T>&& r) {
+  r = l - r;
+  return std::move(r);
+}
+
+template <typename T>
+BasicMatrix<T> operator-(BasicMatrix<T>&& l, BasicMatrix<T>&& r) {
+  l -= r;
+  return std::move(l);
+}
+
+template <typename T>
+BasicMatrix<T> operator*(BasicMatrix<T>&& m, s21_scalar_t<T> number) noexcept {
+  m *= number;
+  return std::move(m);
+}
+
+template <typename T>
+BasicMatrix<T> operator*(s21_scalar_t<T> number, BasicMatrix<T>&& m) noexcept {
+  m *= number;
+  return std::move(m);
+}
+
+template <typename E>
+BasicMatrix<s21_value_t<E>> operator*(
+    const S21MatrixExpr<E>& l, const BasicMatrixView<s21_value_t<E>>& r) {
+  BasicMatrix<s21_value_t<E>> res(l);
+  res.MulMatrix(r);
+  return res;
+}
+
+template <typename L, typename R>
+BasicMatrix<s21_value_t<L>> operator*(const S21MatrixExpr<L>& l,
+                                      const S21MatrixExpr<R>& r) {
+  return l * BasicMatrix<s21_value_t<R>>(r);
+}
+
+template <typename E>
+bool operator==(const S21MatrixExpr<E>& e,
+                const BasicMatrix<s21_value_t<E>>& o) {
+  return e.Eval() == o;
+}
+
+template <typename T>
+std::ostream& operator<<(std::ostream& out, const BasicMatrix<T>& o);
+template <typename T>
+std::istream& operator>>(std::istream& in, BasicMatrix<T>& o);
+
+template <typename E>
+std::ostream& operator<<(std::ostream& out, const S21MatrixExpr<E>& e) {
+  return out << e.Eval();
+}
+
+template <typename T>
+template <typename E>
+BasicMatrix<T>::BasicMatrix(const S21MatrixExpr<E>& e) : BasicMatrix() {
+  *this = e;
+}
+
+// Evaluates expr chunk by chunk and combines each chunk into this matrix
+// with op(dst, values, count). Without op the values are stored in place,
+// straight into the matrix unless expr reads from it.
+template <typename T>
+template <typename E, typename Op>
+void BasicMatrix<T>::Apply(const E& expr, Op op) {
+  bool flat = expr.IsContiguous();
+  long size = static_cast<long>(rows_) * cols_;
+  long width = flat ? size : cols_;
+  long chunks = (width + EXPR_CHUNK - 1) / EXPR_CHUNK;
+  bool direct = std::is_same_v<Op, std::nullptr_t> &&
+                !expr.Overlaps(matrix_, matrix_ + size);
+  T* data = matrix_;
+  int cols = cols_;
+
+  auto body = [&](long begin, long end) {
+    alignas(S21_MATRIX_ALIGNMENT) T work[(E::kBuffers + 1) * EXPR_CHUNK];
+    for (long k = begin; k != end; ++k) {
+      int row = static_cast<int>(k / chunks);
+      long col = k % chunks * EXPR_CHUNK;
+      int count = static_cast<int>(std::min<long>(EXPR_CHUNK, width - col));
+      T* dst = data + static_cast<long>(row) * cols + col;
+      T* out = direct ? dst : work + E::kBuffers * EXPR_CHUNK;
+      const T* values = expr.Row(row, col, count, out, work);
+
+      if constexpr (std::is_same_v<Op, std::nullptr_t>) {
+        if (values != dst) std::copy(values, values + count, dst);
+      } else {
+        op(dst, values, count);
+      }
+    }
+  };
+
+  ForEachChunk((flat ? 1 : rows_) * chunks, std::ref(body));
+}
+
+template <typename T>
+template <typename E>
+BasicMatrix<T>& BasicMatrix<T>::operator=(const S21MatrixExpr<E>& e) {
+  const E& expr = e.Self();
+
+  if (rows_ != expr.GetRows() || cols_ != expr.GetCols()) {
+    BasicMatrix res;
+    if (expr.GetRows() != 0 && expr.GetCols() != 0) {
+      res.Allocate(expr.GetRows(), expr.GetCols());
+      res.Apply(expr, nullptr);
+    }
+    return *this = std::move(res);
+  }
+
+  Apply(expr, nullptr);
+  return *this;
+}
+
+template <typename T>
+template <typename E>
+void BasicMatrix<T>::CheckSize(const S21MatrixExpr<E>& e) const {
+  if (rows_ != e.GetRows() || cols_ != e.GetCols())
+    throw std::logic_error("Matrices have different size of parametrs");
+}
+
+template <typename T>
+template <typename E>
+BasicMatrix<T>& BasicMatrix<T>::operator+=(const S21MatrixExpr<E>& e) {
+  CheckSize(e);
+  Apply(e.Self(), Traits::Add);
+  return *this;
+}
+
+template <typename T>
+template <typename E>
+BasicMatrix<T>& BasicMatrix<T>::operator-=(const S21MatrixExpr<E>& e) {
+  CheckSize(e);
+  Apply(e.Self(), Traits::Sub);
+  return *this;
+}
+
+template <typename T>
+template <typename E>
+bool BasicMatrix<T>::EqMatrix(const S21MatrixExpr<E>& e) const {
+  return EqMatrix(BasicMatrix(e));
+}
+
+template <typename T>
+template <typename E>
+void BasicMatrix<T>::SumMatrix(const S21MatrixExpr<E>& e) {
+  *this += e;
+}
+
+template <typename T>
+template <typename E>
+void BasicMatrix<T>::SubMatrix(const S21MatrixExpr<E>& e) {
+  *this -= e;
+}
+
+template <typename T>
+template <typename E>
+void BasicMatrix<T>::MulMatrix(const S21MatrixExpr<E>& e) {
+  MulMatrix(BasicMatrix(e));
+}
+
+template <typename T>
+template <typename E>
+BasicMatrix<T>& BasicMatrix<T>::operator*=(const S21MatrixExpr<E>& e) {
+  MulMatrix(e);
+  return *this;
+}
@@ -0,0 +1,241 @@
+#include "s21_matrix_qr.h"
+
+#include "s21_matrix_kernels.h"
+#include "s21_matrix_lu.h"
+
+double qr_reflector(double* a, int rows, int lda) {
+  double alpha = a[0], norm = 0;
+  for (int i = 1; i != rows; ++i) {
+    norm += a[static_cast<long>(i) * lda] * a[static_cast<long>(i) * lda];
+  }
+  if (norm == 0) return 0;
+
+  double beta = -std::copysign(sqrt(alpha * alpha + norm), alpha);
+  double scale = 1 / (alpha - beta);
+  for (int i = 1; i != rows; ++i) a[static_cast<long>(i) * lda] *= scale;
+  a[0] = beta;
+  return (beta - alpha) / beta;
+}
+
+void qr_panel(double* a, int rows, int cols, int begin, int end,
+              double* tau) {
+  std::vector<double> w(end - begin);
+
+  for (int k = begin; k != end; ++k) {
+    double* top = a + static_cast<long>(k) * cols;
+    tau[k] = qr_reflector(top + k, rows - k, cols);
+
+    int width = end - k - 1;
+    if (tau[k] == 0 || width == 0) continue;
+
+    std::copy(top + k + 1, top + end, w.begin());
+    for (int i = k + 1; i != rows; ++i) {
+      const double* row = a + static_cast<long>(i) * cols;
+      for (int j = 0; j != width; ++j) w[j] += row[k] * row[k + 1 + j];
+    }
+
+    for (int j = 0; j != width; ++j) top[k + 1 + j] -= tau[k] * w[j];
+    for (int i = k + 1; i != rows; ++i) {
+      double* row = a + static_cast<long>(i) * cols;
+      double factor = tau[k] * row[k];
+      for (int j = 0; j != width; ++j) row[k + 1 + j] -= factor * w[j];
+    }
+  }
+}
+
+void qr_block_t(const double* a, int rows, int cols, int begin, int end,
+                const double* tau, double* t) {
+  int block = end - begin;
+  std::vector<double> z(block);
+
+  for (int j = 0; j != block; ++j) {
+    int k = begin + j;
+    const double* top = a + static_cast<long>(k) * cols;
+
+    std::copy(top + begin, top + k, z.begin());
+    for (int i = k + 1; i != rows; ++i) {
+      const double* row = a + static_cast<long>(i) * cols;
+      for (int p = 0; p != j; ++p) z[p] += row[begin + p] * row[k];
+    }
+
+    for (int r = 0; r != j; ++r) {
+      double sum = 0;
+      for (int p = r; p != j; ++p) sum += t[r * block + p] * z[p];
+      t[r * block + j] = -tau[k] * sum;
+    }
+    t[j * block + j] = tau[k];
+  }
+}
+
+void qr_block_v(const double* a, int rows, int cols, int begin, int end,
+                double* v) {
+  int block = end - begin;
+
+  for (int i = 0; i != rows - begin; ++i) {
+    const double* row = a + static_cast<long>(begin + i) * cols + begin;
+    double* dst = v + static_cast<long>(i) * block;
+    for (int j = 0; j != block; ++j) dst[j] = j < i ? row[j] : j == i;
+  }
+}
+
+void qr_apply(const double* v, const double* t, int rows, int block,
+              double* c, int ldc, int cols, bool transpose) {
+  std::vector<double> w(static_cast<long>(block) * cols);
+  gemm(block, cols, rows, 1, v, 1, block, c, ldc, 1, 0, w.data(), cols);
+
+  if (transpose) {
+    for (int r = block - 1; r >= 0; --r) {
+      double* dst = w.data() + static_cast<long>(r) * cols;
+      for (int j = 0; j != cols; ++j) dst[j] *= t[r * block + r];
+      for (int p = 0; p != r; ++p) {
+        const double* src = w.data() + static_cast<long>(p) * cols;
+        for (int j = 0; j != cols; ++j) dst[j] += t[p * block + r] * src[j];
+      }
+    }
+  } else {
+    for (int r = 0; r != block; ++r) {
+      double* dst = w.data() + static_cast<long>(r) * cols;
+      for (int j = 0; j != cols; ++j) dst[j] *= t[r * block + r];
+      for (int p = r + 1; p != block; ++p) {
+        const double* src = w.data() + static_cast<long>(p) * cols;
+        for (int j = 0; j != cols; ++j) dst[j] += t[r * block + p] * src[j];
+      }
+    }
+  }
+
+  gemm(rows, cols, block, -1, v, block, 1, w.data(), cols, 1, 1, c, ldc);
+}
+
+S21MatrixQr::S21MatrixQr(const S21MatrixView& a)
+    : qr_(a),
+      tau_(a.GetCols()),
+      t_(static_cast<long>(a.GetCols()) * QR_BLOCK),
+      full_rank_(true) {
+  if (a.GetRows() < a.GetCols())
+    throw std::logic_error("The matrix has fewer rows than cols");
+
+  int rows = GetRows(), cols = GetCols();
+  double* data = qr_.Data();
+  std::vector<double> v;
+
+  for (int begin = 0; begin < cols; begin += QR_BLOCK) {
+    int end = std::min(begin + QR_BLOCK, cols);
+    double* t = t_.data() + static_cast<long>(begin) * QR_BLOCK;
+    qr_panel(data, rows, cols, begin, end, tau_.data());
+    qr_block_t(data, rows, cols, begin, end, tau_.data(), t);
+    if (end == cols) break;
+
+    v.resize(static_cast<long>(rows - begin) * (end - begin));
+    qr_block_v(data, rows, cols, begin, end, v.data());
+    qr_apply(v.data(), t, rows - begin, end - begin,
+             data + static_cast<long>(begin) * cols + end, cols, cols - end,
+             true);
+  }
+
+  double tolerance = std::max(rows, cols) * DBL_EPSILON * norm_1(a);
+  for (int k = 0; k != cols; ++k) {
+    if (fabs(qr_.AtUnchecked(k, k)) <= tolerance) full_rank_ = false;
+  }
+}
+
+std::vector<double> S21MatrixQr::Solve(const std::vector<double>& b) const {
+  if (static_cast<long>(b.size()) != GetRows())
+    throw std::logic_error(
+        "The required parameters of matrix have different sizes");
+
+  std::vector<double> rhs(b);
+  S21Matrix x = Solve(S21MatrixView(rhs.data(), GetRows(), 1));
+  return std::vector<double>(x.begin(), x.end());
+}
+
+S21Matrix S21MatrixQr::Solve(const S21MatrixView& b) const {
+  if (b.GetRows() != GetRows())
+    throw std::logic_error(
+        "The required parameters of matrix have different sizes");
+  if (!full_rank_)
+    throw std::logic_error(
+        "The matrix is rank deficient, the least squares solution isn't "
+        "unique");
+
+  int cols = b.GetCols(), size = GetCols();
+  S21Matrix y(b);
+  for (int begin = 0; begin < size; begin += QR_BLOCK) {
+    ApplyBlock(begin, y.Data(), cols, true);
+  }
+  y.SetRows(size);
+
+  const double* a = qr_.Data();
+  double* x = y.Data();
+  for (int end = size; end > 0; end -= QR_BLOCK) {
+    int begin = std::max(end - QR_BLOCK, 0);
+    if (end != size) {
+      gemm(end - begin, cols, size - end, -1,
+           a + static_cast<long>(begin) * size + end, size, 1,
+           x + static_cast<long>(end) * cols, cols, 1, 1,
+           x + static_cast<long>(begin) * cols, cols);
+    }
+
+    for (int i = end - 1; i >= begin; --i) {
+      double* row = x + static_cast<long>(i) * cols;
+      for (int p = i + 1; p != end; ++p) {
+        double factor = a[static_cast<long>(i) * size + p];
+        const double* src = x + static_cast<long>(p) * cols;
+        for (int j = 0; j != cols; ++j) row[j] -= factor * src[j];
+      }
+
+      double inv_diagonal = 1 / a[static_cast<long>(i) * size + i];
+      for (int j = 0; j != cols; ++j) row[j] *= inv_diagonal;
+    }
+  }
+  return y;
+}
+
+S21Matrix S21MatrixQr::Q() const {
+  int cols = GetCols();
+  S21Matrix res(GetRows(), cols);
+  for (int k = 0; k != cols; ++k) res.AtUnchecked(k, k) = 1;
+
+  for (int begin = (cols - 1) / QR_BLOCK * QR_BLOCK; begin >= 0;
+       begin -= QR_BLOCK) {
+    ApplyBlock(begin, res.Data(), cols, false);
+  }
+  return res;
+}
+
+S21Matrix S21MatrixQr::R() const {
+  int cols = GetCols();
+  S21Matrix res(cols, cols);
+  for (int i = 0; i != cols; ++i) {
+    std::copy(qr_[i] + i, qr_[i] + cols, res[i] + i);
+  }
+  return res;
+}
+
+bool S21MatrixQr::IsFullRank() const noexcept { return full_rank_; }
+
+int S21MatrixQr::GetRows() const noexcept { return qr_.GetRows(); }
+
+int S21MatrixQr::GetCols() const noexcept { return qr_.GetCols(); }
+
+const S21Matrix& S21MatrixQr::Packed() const noexcept { return qr_; }
+
+const std::vector<double>& S21MatrixQr::Tau() const noexcept { return tau_; }
+
+void S21MatrixQr::ApplyBlock(int begin, double* c, int cols,
+                             bool transpose) const {
+  int rows = GetRows(), end = std::min(begin + QR_BLOCK, GetCols());
+  std::vector<double> v(static_cast<long>(rows - begin) * (end - begin));
+
+  qr_block_v(qr_.Data(), rows, GetCols(), begin, end, v.data());
+  qr_apply(v.data(), t_.data() + static_cast<long>(begin) * QR_BLOCK,
+           rows - begin, end - begin, c + static_cast<long>(begin) * cols,
+           cols, cols, transpose);
+}
+
+template <typename M>
+S21MatrixQr S21MatrixExtras<M, double>::Qr() const {
+  return S21MatrixQr(static_cast<const M&>(*this));
+}
+
+template S21MatrixQr S21MatrixExtras<S21Matrix, double>::Qr() const;
+template S21MatrixQr S21MatrixExtras<S21MatrixView, double>::Qr() const;
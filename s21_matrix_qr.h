@@ -0,0 +1,29 @@
+#pragma once
+
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+class S21MatrixQr {
+ public:
+  explicit S21MatrixQr(const S21MatrixView& a);
+
+  std::vector<double> Solve(const std::vector<double>& b) const;
+  S21Matrix Solve(const S21MatrixView& b) const;
+  S21Matrix Q() const;
+  S21Matrix R() const;
+
+  bool IsFullRank() const noexcept;
+  int GetRows() const noexcept;
+  int GetCols() const noexcept;
+  const S21Matrix& Packed() const noexcept;
+  const std::vector<double>& Tau() const noexcept;
+
+ private:
+  void ApplyBlock(int begin, double* c, int cols, bool transpose) const;
+
+  S21Matrix qr_;
+  std::vector<double> tau_;
+  std::vector<double> t_;
+  bool full_rank_;
+};
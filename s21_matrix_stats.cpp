@@ -0,0 +1,94 @@
+#include "s21_matrix_stats.h"
+
+#include <atomic>
+
+struct S21OpCounters {
+  std::atomic<long> calls{0};
+  std::atomic<long> nanoseconds{0};
+  std::atomic<long> flops{0};
+};
+
+const char* const s21_op_names[S21_OP_COUNT] = {
+    "EqMatrix",   "SumMatrix", "SubMatrix",   "MulNumber",       "MulMatrix",
+    "Strassen",   "Transpose", "Determinant", "CalcComplements", "Inverse"};
+
+S21OpCounters s21_op_counters[S21_OP_COUNT];
+std::atomic<long> s21_allocations(0);
+std::atomic<long> s21_bytes_allocated(0);
+std::atomic<long> s21_live_bytes(0);
+std::atomic<long> s21_peak_live_bytes(0);
+std::atomic<void (*)(const S21MatrixStats&)> s21_stats_exporter(nullptr);
+
+#ifdef S21_MATRIX_PROFILING
+
+S21StatsScope::S21StatsScope(S21MatrixOp op, long flops) noexcept
+    : op_(op), flops_(flops), start_(std::chrono::steady_clock::now()) {}
+
+S21StatsScope::~S21StatsScope() {
+  auto elapsed = std::chrono::steady_clock::now() - start_;
+  S21OpCounters& counters = s21_op_counters[op_];
+
+  counters.calls.fetch_add(1, std::memory_order_relaxed);
+  counters.nanoseconds.fetch_add(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+      std::memory_order_relaxed);
+  counters.flops.fetch_add(flops_, std::memory_order_relaxed);
+}
+
+void stats_allocate(long size) noexcept {
+  long bytes = size * static_cast<long>(sizeof(double));
+
+  s21_allocations.fetch_add(1, std::memory_order_relaxed);
+  s21_bytes_allocated.fetch_add(bytes, std::memory_order_relaxed);
+  long live =
+      s21_live_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+
+  long peak = s21_peak_live_bytes.load(std::memory_order_relaxed);
+  while (live > peak && !s21_peak_live_bytes.compare_exchange_weak(
+                            peak, live, std::memory_order_relaxed)) {
+  }
+}
+
+void stats_deallocate(long size) noexcept {
+  s21_live_bytes.fetch_sub(size * static_cast<long>(sizeof(double)),
+                           std::memory_order_relaxed);
+}
+
+#endif
+
+S21MatrixStats S21MatrixBase::Stats() noexcept {
+  S21MatrixStats res = {};
+
+  for (int op = 0; op != S21_OP_COUNT; ++op) {
+    res.ops[op].name = s21_op_names[op];
+    res.ops[op].calls = s21_op_counters[op].calls;
+    res.ops[op].nanoseconds = s21_op_counters[op].nanoseconds;
+    res.ops[op].flops = s21_op_counters[op].flops;
+  }
+  res.allocations = s21_allocations;
+  res.bytes_allocated = s21_bytes_allocated;
+  res.live_bytes = s21_live_bytes;
+  res.peak_live_bytes = s21_peak_live_bytes;
+  return res;
+}
+
+void S21MatrixBase::ResetStats() noexcept {
+  for (S21OpCounters& counters : s21_op_counters) {
+    counters.calls = 0;
+    counters.nanoseconds = 0;
+    counters.flops = 0;
+  }
+  s21_allocations = 0;
+  s21_bytes_allocated = 0;
+  s21_peak_live_bytes = s21_live_bytes.load();
+}
+
+void S21MatrixBase::SetStatsExporter(
+    void (*exporter)(const S21MatrixStats& stats)) {
+  s21_stats_exporter = exporter;
+}
+
+void S21MatrixBase::ExportStats() {
+  void (*exporter)(const S21MatrixStats&) = s21_stats_exporter;
+  if (exporter != nullptr) exporter(Stats());
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <chrono>
+
+#include "s21_matrix_oop.h"
+
+#ifdef S21_MATRIX_PROFILING
+
+class S21StatsScope {
+ public:
+  S21StatsScope(S21MatrixOp op, long flops) noexcept;
+  ~S21StatsScope();
+
+  S21StatsScope(const S21StatsScope&) = delete;
+  S21StatsScope& operator=(const S21StatsScope&) = delete;
+
+ private:
+  S21MatrixOp op_;
+  long flops_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+void stats_allocate(long size) noexcept;
+void stats_deallocate(long size) noexcept;
+
+#define S21_STATS_SCOPE(op, flops) S21StatsScope s21_stats_scope(op, flops)
+#define S21_STATS_ALLOCATE(size) stats_allocate(size)
+#define S21_STATS_DEALLOCATE(size) stats_deallocate(size)
+
+#else
+
+#define S21_STATS_SCOPE(op, flops)
+#define S21_STATS_ALLOCATE(size) static_cast<void>(0)
+#define S21_STATS_DEALLOCATE(size) static_cast<void>(0)
+
+#endif
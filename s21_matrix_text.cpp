@@ -0,0 +1,248 @@
+#include "s21_matrix_text.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+
+S21MatrixParseError::S21MatrixParseError(const std::string& what, long line,
+                                         long column)
+    : std::runtime_error("line " + std::to_string(line) + ", column " +
+                         std::to_string(column) + ": " + what),
+      line_(line),
+      column_(column) {}
+
+long S21MatrixParseError::GetLine() const noexcept { return line_; }
+
+long S21MatrixParseError::GetColumn() const noexcept { return column_; }
+
+S21MatrixReader::S21MatrixReader(std::istream& in, S21TextDialect dialect,
+                                 bool header)
+    : in_(in),
+      dialect_(dialect),
+      buffer_(TEXT_BUFFER_SIZE),
+      begin_(0),
+      end_(0),
+      line_(0),
+      row_line_(0),
+      header_(header),
+      header_read_(false),
+      header_rows_(0),
+      header_cols_(0) {}
+
+long S21MatrixReader::GetLine() const noexcept { return row_line_; }
+
+bool S21MatrixReader::NextLine(std::string_view& line) {
+  while (true) {
+    char* first = buffer_.data() + begin_;
+    char* newline =
+        static_cast<char*>(std::memchr(first, '\n', end_ - begin_));
+
+    if (newline != nullptr || (!in_ && begin_ != end_)) {
+      size_t size = newline != nullptr ? newline - first : end_ - begin_;
+      begin_ += newline != nullptr ? size + 1 : size;
+      if (size != 0 && first[size - 1] == '\r') --size;
+      line = std::string_view(first, size);
+      ++line_;
+      return true;
+    }
+    if (!in_) return false;
+
+    std::memmove(buffer_.data(), first, end_ - begin_);
+    end_ -= begin_;
+    begin_ = 0;
+    if (end_ == buffer_.size()) buffer_.resize(buffer_.size() * 2);
+
+    in_.read(buffer_.data() + end_, buffer_.size() - end_);
+    end_ += in_.gcount();
+  }
+}
+
+bool S21MatrixReader::ParseLine(std::string_view line,
+                                std::vector<double>& row) const {
+  const char* first = line.data();
+  const char* last = first + line.size();
+  const char* p = first;
+  bool integral = true;
+  auto blank = [](char c) { return c == ' ' || c == '\t'; };
+  auto column = [&](const char* at) {
+    return static_cast<long>(at - first + 1);
+  };
+
+  row.clear();
+  while (true) {
+    while (p != last && blank(*p)) ++p;
+    if (p == last && (dialect_ == S21_TEXT_WHITESPACE || row.empty())) break;
+
+    const char* token = p;
+    if (p + 1 < last && *p == '+' && p[1] != '-') ++p;
+    double value = 0;
+    auto [end, error] = std::from_chars(p, last, value);
+    if (error != std::errc()) {
+      const char* stop = token;
+      while (stop != last && !blank(*stop) && *stop != ',') ++stop;
+      std::string text(token, stop);
+      std::string what = "Invalid number '" + text + "'";
+      if (text.empty()) what = "Missing value";
+      if (error == std::errc::result_out_of_range)
+        what = "Number '" + text + "' is out of range";
+      throw S21MatrixParseError(what, line_, column(token));
+    }
+
+    for (const char* c = token; c != end; ++c) {
+      if (*c < '0' || *c > '9') integral = false;
+    }
+    row.push_back(value);
+    p = end;
+
+    if (dialect_ == S21_TEXT_WHITESPACE) {
+      if (p != last && !blank(*p)) {
+        throw S21MatrixParseError(
+            std::string("Unexpected character '") + *p + "'", line_,
+            column(p));
+      }
+      continue;
+    }
+
+    while (p != last && blank(*p)) ++p;
+    if (p == last) break;
+    if (*p != ',') {
+      throw S21MatrixParseError(
+          std::string("Expected ',' but found '") + *p + "'", line_,
+          column(p));
+    }
+    ++p;
+  }
+  return integral;
+}
+
+bool S21MatrixReader::NextRow(Row& row) {
+  std::string_view line;
+  while (NextLine(line)) {
+    if (line.find_first_not_of(" \t") == std::string_view::npos) continue;
+
+    ParseLine(line, row.values);
+    row.line = line_;
+    return true;
+  }
+  return false;
+}
+
+void S21MatrixReader::ReadHeader() {
+  if (!header_ || header_read_) return;
+  header_read_ = true;
+
+  std::string_view line;
+  std::vector<double> sizes;
+  while (NextLine(line)) {
+    if (line.find_first_not_of(" \t") == std::string_view::npos) continue;
+
+    bool integral = ParseLine(line, sizes);
+    if (!integral || sizes.size() != 2 || sizes[0] > INT32_MAX ||
+        sizes[1] > INT32_MAX) {
+      throw S21MatrixParseError("Invalid header, expected 'rows cols'",
+                                line_, 1);
+    }
+    header_rows_ = static_cast<int>(sizes[0]);
+    header_cols_ = static_cast<int>(sizes[1]);
+    return;
+  }
+  throw S21MatrixParseError("Missing header", line_, 0);
+}
+
+bool S21MatrixReader::HasHeader() const noexcept { return header_; }
+
+bool S21MatrixReader::ReadRow(std::vector<double>& row) {
+  ReadHeader();
+
+  Row next;
+  if (!NextRow(next)) return false;
+  row.swap(next.values);
+  row_line_ = next.line;
+  return true;
+}
+
+S21Matrix S21MatrixReader::ReadMatrix() {
+  std::vector<double> data, row;
+  long rows = 0;
+  ReadHeader();
+  size_t cols = header_ ? header_cols_ : 0;
+
+  if (header_) {
+    data.reserve(std::min(static_cast<size_t>(header_rows_) * header_cols_,
+                          static_cast<size_t>(TEXT_RESERVE_MAX)));
+  }
+
+  while (ReadRow(row)) {
+    if (rows == 0 && !header_) cols = row.size();
+    if (row.size() != cols) {
+      throw S21MatrixParseError("Expected " + std::to_string(cols) +
+                                    " values but found " +
+                                    std::to_string(row.size()),
+                                row_line_, 0);
+    }
+    if (rows == INT32_MAX)
+      throw S21MatrixParseError("Too many rows", row_line_, 0);
+
+    data.insert(data.end(), row.begin(), row.end());
+    ++rows;
+  }
+
+  if (header_ && rows != header_rows_) {
+    throw S21MatrixParseError("The header declares " +
+                                  std::to_string(header_rows_) +
+                                  " rows but found " + std::to_string(rows),
+                              line_, 0);
+  }
+  if (rows == 0 || cols == 0) return S21Matrix();
+
+  S21Matrix res(static_cast<int>(rows), static_cast<int>(cols),
+                S21Matrix::Uninitialized());
+  std::copy(data.begin(), data.end(), res.Data());
+  return res;
+}
+
+char* format_double(char* first, char* last, double value) noexcept {
+  return std::to_chars(first, last, value).ptr;
+}
+
+S21MatrixWriter::S21MatrixWriter(std::ostream& out, S21TextDialect dialect)
+    : out_(out), dialect_(dialect), buffer_(TEXT_BUFFER_SIZE), size_(0) {}
+
+S21MatrixWriter::~S21MatrixWriter() {
+  try {
+    Flush();
+  } catch (...) {
+  }
+}
+
+void S21MatrixWriter::WriteHeader(int rows, int cols) {
+  double sizes[] = {static_cast<double>(rows), static_cast<double>(cols)};
+  WriteRow(sizes, 2);
+}
+
+void S21MatrixWriter::WriteRow(const double* row, int cols) {
+  char separator = dialect_ == S21_TEXT_CSV ? ',' : ' ';
+
+  for (int j = 0; j != cols; ++j) {
+    if (buffer_.size() - size_ < 32) Flush();
+
+    char* first = buffer_.data() + size_;
+    if (j != 0) *first++ = separator;
+    size_ = format_double(first, first + 30, row[j]) - buffer_.data();
+  }
+  if (size_ == buffer_.size()) Flush();
+  buffer_[size_++] = '\n';
+}
+
+void S21MatrixWriter::WriteMatrix(const S21MatrixView& m, bool header) {
+  if (header) WriteHeader(m.GetRows(), m.GetCols());
+  for (const double* row : m.Rows()) WriteRow(row, m.GetCols());
+  Flush();
+}
+
+void S21MatrixWriter::Flush() {
+  out_.write(buffer_.data(), size_);
+  size_ = 0;
+  if (!out_) throw std::runtime_error("Cannot write the matrix text");
+}
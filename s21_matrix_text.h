@@ -0,0 +1,78 @@
+#pragma once
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+#define TEXT_BUFFER_SIZE (1 << 16)
+#define TEXT_RESERVE_MAX (1 << 20)
+
+enum S21TextDialect { S21_TEXT_WHITESPACE, S21_TEXT_CSV };
+
+class S21MatrixParseError : public std::runtime_error {
+ public:
+  S21MatrixParseError(const std::string& what, long line, long column);
+
+  long GetLine() const noexcept;
+  long GetColumn() const noexcept;
+
+ private:
+  long line_, column_;
+};
+
+class S21MatrixReader {
+ public:
+  explicit S21MatrixReader(std::istream& in,
+                           S21TextDialect dialect = S21_TEXT_WHITESPACE,
+                           bool header = false);
+
+  bool HasHeader() const noexcept;
+  bool ReadRow(std::vector<double>& row);
+  S21Matrix ReadMatrix();
+  long GetLine() const noexcept;
+
+ private:
+  struct Row {
+    std::vector<double> values;
+    long line;
+  };
+
+  bool NextLine(std::string_view& line);
+  bool ParseLine(std::string_view line, std::vector<double>& row) const;
+  bool NextRow(Row& row);
+  void ReadHeader();
+
+  std::istream& in_;
+  S21TextDialect dialect_;
+  std::vector<char> buffer_;
+  size_t begin_, end_;
+  long line_, row_line_;
+  bool header_, header_read_;
+  int header_rows_, header_cols_;
+};
+
+class S21MatrixWriter {
+ public:
+  explicit S21MatrixWriter(std::ostream& out,
+                           S21TextDialect dialect = S21_TEXT_WHITESPACE);
+  S21MatrixWriter(const S21MatrixWriter&) = delete;
+  S21MatrixWriter& operator=(const S21MatrixWriter&) = delete;
+  ~S21MatrixWriter();
+
+  void WriteHeader(int rows, int cols);
+  void WriteRow(const double* row, int cols);
+  void WriteMatrix(const S21MatrixView& m, bool header = false);
+  void Flush();
+
+ private:
+  std::ostream& out_;
+  S21TextDialect dialect_;
+  std::vector<char> buffer_;
+  size_t size_;
+};
+
+char* format_double(char* first, char* last, double value) noexcept;
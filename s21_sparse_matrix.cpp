@@ -0,0 +1,333 @@
+#include "s21_sparse_matrix.h"
+
+#include "s21_matrix_kernels.h"
+#include "s21_thread_pool.h"
+
+S21SparseMatrix::Builder::Builder(int rows, int cols)
+    : rows_(rows), cols_(cols) {
+  if (rows < 1 || cols < 1)
+    throw std::invalid_argument("Sizes of rows or cols must be greater than 0");
+}
+
+void S21SparseMatrix::Builder::Add(int row, int col, double value) {
+  if (row >= rows_ || col >= cols_ || row < 0 || col < 0)
+    throw std::out_of_range("Incorrect parametrs of Matrix");
+
+  entries_.push_back({row, col, value});
+}
+
+void S21SparseMatrix::Builder::Reserve(long count) { entries_.reserve(count); }
+
+S21SparseMatrix S21SparseMatrix::Builder::Build() const {
+  std::vector<Entry> sorted(entries_);
+  std::stable_sort(sorted.begin(), sorted.end(),
+                   [](const Entry& a, const Entry& b) {
+                     return a.row != b.row ? a.row < b.row : a.col < b.col;
+                   });
+
+  S21SparseMatrix res(rows_, cols_);
+  res.col_indices_.reserve(sorted.size());
+  res.values_.reserve(sorted.size());
+
+  for (size_t i = 0; i != sorted.size();) {
+    double sum = 0;
+    size_t j = i;
+    for (; j != sorted.size() && sorted[j].row == sorted[i].row &&
+           sorted[j].col == sorted[i].col;
+         ++j) {
+      sum += sorted[j].value;
+    }
+
+    if (sum != 0) {
+      res.col_indices_.push_back(sorted[i].col);
+      res.values_.push_back(sum);
+      ++res.row_offsets_[sorted[i].row + 1];
+    }
+    i = j;
+  }
+
+  for (int i = 0; i != rows_; ++i) {
+    res.row_offsets_[i + 1] += res.row_offsets_[i];
+  }
+  return res;
+}
+
+S21SparseMatrix::S21SparseMatrix() noexcept
+    : rows_(0), cols_(0), row_offsets_(1, 0) {}
+
+S21SparseMatrix::S21SparseMatrix(int rows, int cols)
+    : rows_(rows), cols_(cols) {
+  if (rows < 1 || cols < 1)
+    throw std::invalid_argument("Sizes of rows or cols must be greater than 0");
+
+  row_offsets_.assign(rows + 1L, 0);
+}
+
+S21SparseMatrix::S21SparseMatrix(const S21MatrixView& dense, double tolerance)
+    : S21SparseMatrix() {
+  if (dense.GetRows() == 0 || dense.GetCols() == 0) return;
+
+  rows_ = dense.GetRows();
+  cols_ = dense.GetCols();
+  row_offsets_.assign(rows_ + 1L, 0);
+
+  for (int i = 0; i != rows_; ++i) {
+    const double* row = dense.RowPtr(i);
+    for (int j = 0; j != cols_; ++j) {
+      if (!(fabs(row[j]) <= tolerance)) {
+        col_indices_.push_back(j);
+        values_.push_back(row[j]);
+      }
+    }
+    row_offsets_[i + 1] = values_.size();
+  }
+}
+
+double S21SparseMatrix::operator()(int row, int col) const {
+  if (row >= rows_ || col >= cols_ || row < 0 || col < 0)
+    throw std::out_of_range("Incorrect parametrs of Matrix");
+
+  const int* first = col_indices_.data() + row_offsets_[row];
+  const int* last = col_indices_.data() + row_offsets_[row + 1];
+  const int* it = std::lower_bound(first, last, col);
+
+  return it != last && *it == col ? values_[it - col_indices_.data()] : 0;
+}
+
+bool S21SparseMatrix::EqMatrix(const S21SparseMatrix& o) const noexcept {
+  if (rows_ != o.rows_ || cols_ != o.cols_) return false;
+
+  for (int i = 0; i != rows_; ++i) {
+    long a = row_offsets_[i], a_end = row_offsets_[i + 1];
+    long b = o.row_offsets_[i], b_end = o.row_offsets_[i + 1];
+
+    while (a != a_end || b != b_end) {
+      double diff;
+      if (b == b_end ||
+          (a != a_end && col_indices_[a] < o.col_indices_[b])) {
+        diff = values_[a++];
+      } else if (a == a_end || o.col_indices_[b] < col_indices_[a]) {
+        diff = o.values_[b++];
+      } else {
+        diff = values_[a++] - o.values_[b++];
+      }
+      if (fabs(diff) > PRECISION) return false;
+    }
+  }
+  return true;
+}
+
+bool S21SparseMatrix::operator==(const S21SparseMatrix& o) const noexcept {
+  return EqMatrix(o);
+}
+
+template <typename Op>
+S21SparseMatrix S21SparseMatrix::Merge(const S21SparseMatrix& o,
+                                       Op op) const {
+  if (rows_ != o.rows_ || cols_ != o.cols_)
+    throw std::logic_error("Matrices have different size of parametrs");
+
+  S21SparseMatrix res;
+  res.rows_ = rows_;
+  res.cols_ = cols_;
+  res.row_offsets_.assign(rows_ + 1L, 0);
+  res.col_indices_.reserve(values_.size() + o.values_.size());
+  res.values_.reserve(values_.size() + o.values_.size());
+
+  for (int i = 0; i != rows_; ++i) {
+    long a = row_offsets_[i], a_end = row_offsets_[i + 1];
+    long b = o.row_offsets_[i], b_end = o.row_offsets_[i + 1];
+
+    while (a != a_end || b != b_end) {
+      int col;
+      double value;
+      if (b == b_end ||
+          (a != a_end && col_indices_[a] < o.col_indices_[b])) {
+        col = col_indices_[a];
+        value = op(values_[a++], 0);
+      } else if (a == a_end || o.col_indices_[b] < col_indices_[a]) {
+        col = o.col_indices_[b];
+        value = op(0, o.values_[b++]);
+      } else {
+        col = col_indices_[a];
+        value = op(values_[a++], o.values_[b++]);
+      }
+
+      if (value != 0) {
+        res.col_indices_.push_back(col);
+        res.values_.push_back(value);
+      }
+    }
+    res.row_offsets_[i + 1] = res.values_.size();
+  }
+  return res;
+}
+
+S21SparseMatrix S21SparseMatrix::operator+(const S21SparseMatrix& o) const {
+  return Merge(o, [](double a, double b) { return a + b; });
+}
+
+S21SparseMatrix S21SparseMatrix::operator-(const S21SparseMatrix& o) const {
+  return Merge(o, [](double a, double b) { return a - b; });
+}
+
+S21SparseMatrix S21SparseMatrix::operator*(double o) const {
+  S21SparseMatrix res(*this);
+  simd_kernels().mul_number(res.values_.data(), res.values_.size(), o,
+                            PRECISION);
+
+  long kept = 0, begin = 0;
+  for (int i = 0; i != rows_; ++i) {
+    long end = res.row_offsets_[i + 1];
+    for (long p = begin; p != end; ++p) {
+      if (res.values_[p] == 0) continue;
+      res.col_indices_[kept] = res.col_indices_[p];
+      res.values_[kept++] = res.values_[p];
+    }
+    res.row_offsets_[i + 1] = kept;
+    begin = end;
+  }
+  res.col_indices_.resize(kept);
+  res.values_.resize(kept);
+  return res;
+}
+
+void S21SparseMatrix::Multiply(const double* x, double* y) const noexcept {
+  long grain = PARALLEL_GRAIN / (values_.size() / (rows_ + 1) + 1) + 1;
+
+  parallel_for(0, rows_, grain, [&](long begin, long end) {
+    for (long i = begin; i != end; ++i) {
+      double sum = 0;
+      for (long p = row_offsets_[i]; p != row_offsets_[i + 1]; ++p) {
+        sum += values_[p] * x[col_indices_[p]];
+      }
+      y[i] = sum;
+    }
+  });
+}
+
+std::vector<double> S21SparseMatrix::operator*(
+    const std::vector<double>& x) const {
+  if (x.size() != static_cast<size_t>(cols_)) {
+    throw std::logic_error(
+        "The required parameters of matrix have different sizes");
+  }
+
+  std::vector<double> y(rows_);
+  Multiply(x.data(), y.data());
+  return y;
+}
+
+S21Matrix S21SparseMatrix::operator*(const S21MatrixView& o) const {
+  if (cols_ != o.GetRows() || o.GetCols() < 1 || rows_ < 1) {
+    throw std::logic_error(
+        "The required parameters of matrix have different sizes");
+  }
+
+  int n = o.GetCols();
+  S21Matrix res(rows_, n);
+  double* out = res.Data();
+  long grain =
+      PARALLEL_GRAIN / ((values_.size() / rows_ + 1) * static_cast<long>(n)) +
+      1;
+
+  parallel_for(0, rows_, grain, [&](long begin, long end) {
+    for (long i = begin; i != end; ++i) {
+      double* row = out + i * n;
+      for (long p = row_offsets_[i]; p != row_offsets_[i + 1]; ++p) {
+        double value = values_[p];
+        const double* b = o.RowPtr(col_indices_[p]);
+        for (int j = 0; j != n; ++j) row[j] += value * b[j];
+      }
+    }
+  });
+  flush_to_zero(out, rows_, n, n, PRECISION);
+  return res;
+}
+
+S21Matrix operator*(const S21MatrixView& l, const S21SparseMatrix& r) {
+  if (l.GetCols() != r.GetRows() || l.GetRows() < 1) {
+    throw std::logic_error(
+        "The required parameters of matrix have different sizes");
+  }
+
+  int n = r.GetCols();
+  S21Matrix res(l.GetRows(), n);
+  double* out = res.Data();
+  const long* offsets = r.RowOffsets();
+  const int* cols = r.ColIndices();
+  const double* values = r.Values();
+  long grain = PARALLEL_GRAIN / (r.GetNonZeros() + 1) + 1;
+
+  parallel_for(0, l.GetRows(), grain, [&](long begin, long end) {
+    for (long i = begin; i != end; ++i) {
+      const double* a = l.RowPtr(i);
+      double* row = out + i * n;
+      for (int k = 0; k != l.GetCols(); ++k) {
+        if (a[k] == 0) continue;
+        for (long p = offsets[k]; p != offsets[k + 1]; ++p) {
+          row[cols[p]] += a[k] * values[p];
+        }
+      }
+    }
+  });
+  flush_to_zero(out, l.GetRows(), n, n, PRECISION);
+  return res;
+}
+
+S21SparseMatrix S21SparseMatrix::Transpose() const {
+  S21SparseMatrix res;
+  if (rows_ == 0) return res;
+
+  res.rows_ = cols_;
+  res.cols_ = rows_;
+  res.row_offsets_.assign(cols_ + 1L, 0);
+  res.col_indices_.resize(values_.size());
+  res.values_.resize(values_.size());
+
+  for (int col : col_indices_) ++res.row_offsets_[col + 1];
+  for (int j = 0; j != cols_; ++j) {
+    res.row_offsets_[j + 1] += res.row_offsets_[j];
+  }
+
+  std::vector<long> next(res.row_offsets_.begin(), res.row_offsets_.end() - 1);
+  for (int i = 0; i != rows_; ++i) {
+    for (long p = row_offsets_[i]; p != row_offsets_[i + 1]; ++p) {
+      long q = next[col_indices_[p]]++;
+      res.col_indices_[q] = i;
+      res.values_[q] = values_[p];
+    }
+  }
+  return res;
+}
+
+S21Matrix S21SparseMatrix::ToDense() const {
+  if (rows_ == 0) return S21Matrix();
+
+  S21Matrix res(rows_, cols_);
+  for (int i = 0; i != rows_; ++i) {
+    double* row = res.RowPtr(i);
+    for (long p = row_offsets_[i]; p != row_offsets_[i + 1]; ++p) {
+      row[col_indices_[p]] = values_[p];
+    }
+  }
+  return res;
+}
+
+int S21SparseMatrix::GetRows() const noexcept { return rows_; }
+
+int S21SparseMatrix::GetCols() const noexcept { return cols_; }
+
+long S21SparseMatrix::GetNonZeros() const noexcept { return values_.size(); }
+
+const long* S21SparseMatrix::RowOffsets() const noexcept {
+  return row_offsets_.data();
+}
+
+const int* S21SparseMatrix::ColIndices() const noexcept {
+  return col_indices_.data();
+}
+
+const double* S21SparseMatrix::Values() const noexcept {
+  return values_.data();
+}
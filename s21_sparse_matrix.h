@@ -0,0 +1,61 @@
+#pragma once
+
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+class S21SparseMatrix {
+ public:
+  class Builder {
+   public:
+    Builder(int rows, int cols);
+
+    void Add(int row, int col, double value);
+    void Reserve(long count);
+    S21SparseMatrix Build() const;
+
+   private:
+    struct Entry {
+      int row, col;
+      double value;
+    };
+
+    int rows_, cols_;
+    std::vector<Entry> entries_;
+  };
+
+  S21SparseMatrix() noexcept;
+  S21SparseMatrix(int rows, int cols);
+  explicit S21SparseMatrix(const S21MatrixView& dense, double tolerance = 0);
+
+  double operator()(int row, int col) const;
+  bool operator==(const S21SparseMatrix& o) const noexcept;
+  S21SparseMatrix operator+(const S21SparseMatrix& o) const;
+  S21SparseMatrix operator-(const S21SparseMatrix& o) const;
+  S21SparseMatrix operator*(double o) const;
+  S21Matrix operator*(const S21MatrixView& o) const;
+  std::vector<double> operator*(const std::vector<double>& x) const;
+
+  bool EqMatrix(const S21SparseMatrix& o) const noexcept;
+  void Multiply(const double* x, double* y) const noexcept;
+  S21SparseMatrix Transpose() const;
+  S21Matrix ToDense() const;
+
+  int GetRows() const noexcept;
+  int GetCols() const noexcept;
+  long GetNonZeros() const noexcept;
+  const long* RowOffsets() const noexcept;
+  const int* ColIndices() const noexcept;
+  const double* Values() const noexcept;
+
+ private:
+  template <typename Op>
+  S21SparseMatrix Merge(const S21SparseMatrix& o, Op op) const;
+
+  int rows_, cols_;
+  std::vector<long> row_offsets_;
+  std::vector<int> col_indices_;
+  std::vector<double> values_;
+};
+
+S21Matrix operator*(const S21MatrixView& l, const S21SparseMatrix& r);
@@ -0,0 +1,189 @@
+#include "s21_thread_pool.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+thread_local bool s21_in_parallel_region = false;
+
+uint64_t pack_range(uint32_t lo, uint32_t hi) {
+  return static_cast<uint64_t>(lo) << 32 | hi;
+}
+
+uint32_t range_lo(uint64_t range) { return static_cast<uint32_t>(range >> 32); }
+
+uint32_t range_hi(uint64_t range) { return static_cast<uint32_t>(range); }
+
+S21ThreadPool& S21ThreadPool::Instance() {
+  static S21ThreadPool pool;
+  return pool;
+}
+
+S21ThreadPool::S21ThreadPool()
+    : thread_count_(1),
+      stop_(false),
+      generation_(0),
+      participants_(0),
+      finished_(0),
+      body_(nullptr),
+      begin_(0),
+      end_(0),
+      grain_(1) {
+  Start(std::max(1u, std::thread::hardware_concurrency()));
+}
+
+S21ThreadPool::~S21ThreadPool() { Stop(); }
+
+void S21ThreadPool::SetThreadCount(int count) {
+  if (count < 0)
+    throw std::invalid_argument("The number of threads can't be negative");
+
+  if (count == 0) count = std::max(1u, std::thread::hardware_concurrency());
+
+  std::lock_guard<std::mutex> job_lock(job_mutex_);
+  if (count == thread_count_) return;
+
+  Stop();
+  Start(count);
+}
+
+int S21ThreadPool::GetThreadCount() const noexcept { return thread_count_; }
+
+void S21ThreadPool::Start(int count) {
+  stop_ = false;
+  thread_count_ = count;
+  ranges_.reset(new std::atomic<uint64_t>[count]);
+
+  for (int i = 1; i < count; ++i) {
+    workers_.emplace_back(&S21ThreadPool::WorkerLoop, this, i, generation_);
+  }
+}
+
+void S21ThreadPool::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    stop_ = true;
+  }
+  wake_.notify_all();
+
+  for (std::thread& worker : workers_) worker.join();
+  workers_.clear();
+}
+
+void S21ThreadPool::ParallelFor(long begin, long end, long grain,
+                                const Body& body) {
+  if (end <= begin) return;
+
+  grain = std::max(1L, grain);
+  long chunks = (end - begin + grain - 1) / grain;
+
+  if (chunks < 2 || thread_count_ < 2 || s21_in_parallel_region ||
+      chunks > UINT32_MAX || !job_mutex_.try_lock()) {
+    body(begin, end);
+    return;
+  }
+
+  std::lock_guard<std::mutex> job_lock(job_mutex_, std::adopt_lock);
+  int participants = static_cast<int>(std::min<long>(thread_count_, chunks));
+
+  for (int i = 0; i != participants; ++i) {
+    ranges_[i] = pack_range(chunks * i / participants,
+                            chunks * (i + 1) / participants);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    body_ = &body;
+    begin_ = begin;
+    end_ = end;
+    grain_ = grain;
+    participants_ = participants;
+    finished_ = 1;
+    error_ = nullptr;
+    ++generation_;
+  }
+  wake_.notify_all();
+
+  RunParticipant(0);
+
+  std::unique_lock<std::mutex> lock(state_mutex_);
+  done_.wait(lock, [this] { return finished_ == participants_; });
+  body_ = nullptr;
+
+  if (error_) std::rethrow_exception(error_);
+}
+
+void S21ThreadPool::WorkerLoop(int index, uint64_t seen) {
+  for (;;) {
+    {
+      std::unique_lock<std::mutex> lock(state_mutex_);
+      wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+      if (stop_) return;
+
+      seen = generation_;
+      if (index >= participants_) continue;
+    }
+
+    RunParticipant(index);
+
+    {
+      std::lock_guard<std::mutex> lock(state_mutex_);
+      ++finished_;
+    }
+    done_.notify_one();
+  }
+}
+
+void S21ThreadPool::RunParticipant(int index) {
+  s21_in_parallel_region = true;
+
+  try {
+    long chunk = 0;
+    while (PopChunk(index, chunk) || (StealChunks(index) &&
+                                      PopChunk(index, chunk))) {
+      long lo = begin_ + chunk * grain_;
+      (*body_)(lo, std::min(end_, lo + grain_));
+    }
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    if (!error_) error_ = std::current_exception();
+  }
+
+  s21_in_parallel_region = false;
+}
+
+bool S21ThreadPool::PopChunk(int index, long& chunk) {
+  std::atomic<uint64_t>& own = ranges_[index];
+  uint64_t range = own.load();
+
+  while (range_lo(range) < range_hi(range)) {
+    if (own.compare_exchange_weak(
+            range, pack_range(range_lo(range) + 1, range_hi(range)))) {
+      chunk = range_lo(range);
+      return true;
+    }
+  }
+  return false;
+}
+
+bool S21ThreadPool::StealChunks(int index) {
+  for (int offset = 1; offset != participants_; ++offset) {
+    std::atomic<uint64_t>& victim = ranges_[(index + offset) % participants_];
+    uint64_t range = victim.load();
+
+    while (range_lo(range) < range_hi(range)) {
+      uint32_t lo = range_lo(range), hi = range_hi(range);
+      uint32_t mid = hi - std::max(1u, (hi - lo) / 2);
+
+      if (victim.compare_exchange_weak(range, pack_range(lo, mid))) {
+        ranges_[index] = pack_range(mid, hi);
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+void parallel_for(long begin, long end, long grain,
+                  const S21ThreadPool::Body& body) {
+  S21ThreadPool::Instance().ParallelFor(begin, end, grain, body);
+}
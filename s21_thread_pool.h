@@ -0,0 +1,56 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class S21ThreadPool {
+ public:
+  using Body = std::function<void(long begin, long end)>;
+
+  static S21ThreadPool& Instance();
+
+  S21ThreadPool(const S21ThreadPool&) = delete;
+  S21ThreadPool& operator=(const S21ThreadPool&) = delete;
+  ~S21ThreadPool();
+
+  void SetThreadCount(int count);
+  int GetThreadCount() const noexcept;
+  void ParallelFor(long begin, long end, long grain, const Body& body);
+
+ private:
+  S21ThreadPool();
+
+  void Start(int count);
+  void Stop();
+  void WorkerLoop(int index, uint64_t seen);
+  void RunParticipant(int index);
+  bool PopChunk(int index, long& chunk);
+  bool StealChunks(int index);
+
+  std::vector<std::thread> workers_;
+  std::atomic<int> thread_count_;
+
+  std::mutex job_mutex_;
+  std::mutex state_mutex_;
+  std::condition_variable wake_;
+  std::condition_variable done_;
+  bool stop_;
+  uint64_t generation_;
+  int participants_;
+  int finished_;
+
+  const Body* body_;
+  long begin_, end_, grain_;
+  std::unique_ptr<std::atomic<uint64_t>[]> ranges_;
+  std::exception_ptr error_;
+};
+
+void parallel_for(long begin, long end, long grain,
+                  const S21ThreadPool::Body& body);
@@ -0,0 +1,200 @@
+#include "../s21_basic_matrix.h"
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <cstdio>
+
+template <typename T>
+BasicMatrix<T> basic_fill(int rows, int cols) {
+  BasicMatrix<T> res(rows, cols);
+  for (int i = 0; i != rows; ++i) {
+    for (int j = 0; j != cols; ++j) {
+      res(i, j) = static_cast<T>((i * 7 + j * 3) % 11) - 5 + (i == j) * 9;
+    }
+  }
+  return res;
+}
+
+TEST(test_basic_matrix, test_alias) {
+  EXPECT_TRUE((std::is_same_v<S21Matrix, BasicMatrix<double>>));
+  EXPECT_TRUE((std::is_same_v<S21Matrix::Traits, S21MatrixTraits<double>>));
+  EXPECT_EQ(S21MatrixTraits<double>::tolerance, PRECISION);
+  EXPECT_TRUE(S21MatrixTraits<int64_t>::exact);
+  EXPECT_FALSE(S21MatrixTraits<std::complex<double>>::exact);
+
+  S21Matrix dense(2, 3);
+  dense(1, 2) = 2.75;
+  S21MatrixFloat single(dense);
+  EXPECT_EQ(single.GetRows(), 2);
+  EXPECT_FLOAT_EQ(single(1, 2), 2.75f);
+  EXPECT_EQ(S21MatrixInt64(dense)(1, 2), 2);
+  EXPECT_EQ(S21MatrixFloat(S21Matrix()).GetRows(), 0);
+}
+
+TEST(test_basic_matrix, test_float) {
+  for (int size : {1, 5, 37, 130}) {
+    S21Matrix a = S21Matrix(size, size + 3), b = S21Matrix(size + 3, size);
+    for (int i = 0; i != size; ++i) {
+      for (int j = 0; j != size + 3; ++j) {
+        a(i, j) = std::sin(i + 0.5 * j);
+        b(j, i) = std::cos(i - 0.25 * j);
+      }
+    }
+
+    S21MatrixFloat fa(a), fb(b);
+    EXPECT_EQ(fa * fb, S21MatrixFloat(a * b));
+    EXPECT_EQ(fa + fa, S21MatrixFloat(S21Matrix(a + a)));
+    EXPECT_EQ(fa - fa * 0.5f, S21MatrixFloat(S21Matrix(a * 0.5)));
+    EXPECT_EQ(fa.Transpose(), S21MatrixFloat(a.Transpose()));
+    EXPECT_EQ(2.0f * fa, fa + fa);
+  }
+
+  S21Matrix wide(3, GEMM_KC + 40), tall(GEMM_KC + 40, GEMM_TILE_N + 70);
+  for (int i = 0; i != 3 * (GEMM_KC + 40); ++i) wide.Data()[i] = i % 5 - 2;
+  for (int i = 0; i != (GEMM_KC + 40) * (GEMM_TILE_N + 70); ++i) {
+    tall.Data()[i] = (i % 9) * 0.5 - 2;
+  }
+  EXPECT_EQ(S21MatrixFloat(wide) * S21MatrixFloat(tall),
+            S21MatrixFloat(wide * tall));
+
+  S21Matrix square = S21Matrix(6, 6);
+  for (int i = 0; i != 6; ++i) {
+    for (int j = 0; j != 6; ++j) square(i, j) = std::sin(i * 6 + j) + (i == j);
+  }
+  S21MatrixFloat single(square);
+  EXPECT_NEAR(single.Determinant(), square.Determinant(), 1e-4);
+  EXPECT_EQ(single.InverseMatrix(), S21MatrixFloat(square.InverseMatrix()));
+  EXPECT_EQ(single.CalcComplements(),
+            S21MatrixFloat(square.CalcComplements()));
+
+  EXPECT_THROW(single + S21MatrixFloat(5, 6), std::logic_error);
+  EXPECT_THROW(single * S21MatrixFloat(5, 6), std::logic_error);
+  EXPECT_THROW(S21MatrixFloat(2, 3).Determinant(), std::logic_error);
+  EXPECT_THROW(S21MatrixFloat(3, 3).InverseMatrix(), std::logic_error);
+  EXPECT_THROW(S21MatrixFloat(0, 3), std::invalid_argument);
+#ifndef S21_MATRIX_NO_BOUNDS_CHECK
+  EXPECT_THROW(single(6, 0), std::out_of_range);
+#endif
+}
+
+TEST(test_basic_matrix, test_int64) {
+  S21MatrixInt64 a = basic_fill<int64_t>(7, 7);
+  S21Matrix dense = basic_fill<double>(7, 7);
+  EXPECT_EQ(a.Determinant(), std::llround(dense.Determinant()));
+  S21MatrixInt64 complements = a.CalcComplements();
+  S21Matrix dense_complements = dense.CalcComplements();
+  for (int i = 0; i != 49; ++i) {
+    EXPECT_EQ(complements.Data()[i], std::llround(dense_complements.Data()[i]));
+  }
+  EXPECT_EQ((a * a)(3, 4), std::llround((dense * dense)(3, 4)));
+
+  S21MatrixInt64 unimodular(3, 3);
+  int64_t values[] = {2, 3, 1, 1, 2, 1, 3, 5, 3};
+  std::copy(values, values + 9, unimodular.Data());
+  EXPECT_EQ(unimodular.Determinant(), 1);
+  S21MatrixInt64 identity(3, 3);
+  for (int i = 0; i != 3; ++i) identity(i, i) = 1;
+  EXPECT_EQ(unimodular * unimodular.InverseMatrix(), identity);
+
+  S21MatrixInt64 exact(2, 2);
+  exact(0, 0) = 3000000000LL, exact(0, 1) = 2999999999LL;
+  exact(1, 0) = 2999999999LL, exact(1, 1) = 2999999998LL;
+  EXPECT_EQ(exact.Determinant(), -1);
+  EXPECT_EQ(exact.InverseMatrix()(0, 0), -2999999998LL);
+
+  EXPECT_THROW(a.InverseMatrix(), std::logic_error);
+  EXPECT_THROW((a * 0).InverseMatrix(), std::logic_error);
+  EXPECT_EQ((a * 0).Determinant(), 0);
+
+  S21MatrixInt64 huge(2, 2);
+  huge(0, 0) = huge(1, 1) = 1LL << 40;
+  huge(0, 1) = 1;
+  EXPECT_THROW(huge.Determinant(), std::overflow_error);
+}
+
+TEST(test_basic_matrix, test_int64_singular_complements) {
+  S21MatrixInt64 a = basic_fill<int64_t>(6, 6);
+  for (int j = 0; j != 6; ++j) a(4, j) = a(0, j) - 2 * a(2, j);
+  S21Matrix dense(6, 6);
+  std::copy(a.begin(), a.end(), dense.begin());
+
+  EXPECT_EQ(a.Determinant(), 0);
+  S21MatrixInt64 complements = a.CalcComplements();
+  S21Matrix dense_complements = dense.CalcComplements();
+  bool nonzero = false;
+  for (int i = 0; i != 36; ++i) {
+    EXPECT_EQ(complements.Data()[i], std::llround(dense_complements.Data()[i]));
+    nonzero = nonzero || complements.Data()[i] != 0;
+  }
+  EXPECT_TRUE(nonzero);
+
+  for (int j = 0; j != 6; ++j) a(5, j) = a(1, j) + a(3, j);
+  EXPECT_EQ(a.CalcComplements(), S21MatrixInt64(6, 6));
+}
+
+TEST(test_basic_matrix, test_shared_paths) {
+  S21Matrix square(40, 40);
+  for (int i = 0; i != 40; ++i) {
+    for (int j = 0; j != 40; ++j) {
+      square(i, j) = 0.01 * std::sin(i * 40 + j) + (i == j);
+    }
+  }
+  S21MatrixFloat single(square);
+  EXPECT_EQ(single.InverseMatrix(), S21MatrixFloat(square.InverseMatrix()));
+  EXPECT_EQ(single.CalcComplements(),
+            S21MatrixFloat(square.CalcComplements()));
+  EXPECT_NEAR(single.Determinant(), square.Determinant(), 1e-4);
+
+  S21MatrixFloat block(single.Block(2, 3, 10, 12));
+  EXPECT_EQ(block(1, 1), single(3, 4));
+  S21MatrixFloat product(10, 10);
+  S21MatrixFloat::Gemm(1, block, false, block, true, 0, product);
+  EXPECT_EQ(product, S21MatrixFloat(S21Matrix(square.Block(2, 3, 10, 12) *
+                                              square.Block(2, 3, 10, 12)
+                                                  .Transpose())));
+
+  using Complex = std::complex<double>;
+  S21MatrixComplex c(3, 5);
+  for (int i = 0; i != 15; ++i) c.Data()[i] = Complex(i % 4, 1 - i % 3);
+  BasicMatrixView<Complex> view = c.Block(1, 1, 2, 3);
+  view.MulNumber(Complex(0, 1));
+  EXPECT_EQ(c(1, 2), Complex(1 - 7 % 3, 7 % 4));
+  EXPECT_EQ(c(0, 2), Complex(2, 1 - 2 % 3));
+
+  std::string path = testing::TempDir() + "s21_basic_matrix.bin";
+  c.Save(path);
+  EXPECT_EQ(S21MatrixComplex::Load(path), c);
+  EXPECT_EQ(S21MatrixComplex::Map(path), c);
+  EXPECT_THROW(S21Matrix::Load(path), std::runtime_error);
+  block.Save(path);
+  EXPECT_EQ(S21MatrixFloat::Load(path), block);
+  EXPECT_THROW(S21MatrixInt64::Load(path), std::runtime_error);
+  std::remove(path.c_str());
+}
+
+TEST(test_basic_matrix, test_complex) {
+  using Complex = std::complex<double>;
+  S21MatrixComplex a(4, 4);
+  for (int i = 0; i != 4; ++i) {
+    for (int j = 0; j != 4; ++j) {
+      a(i, j) = Complex(std::sin(i + 2 * j), std::cos(i * j)) +
+                Complex(i == j ? 3 : 0, 0);
+    }
+  }
+
+  S21MatrixComplex identity(4, 4);
+  for (int i = 0; i != 4; ++i) identity(i, i) = 1;
+  EXPECT_EQ(a * a.InverseMatrix(), identity);
+  EXPECT_EQ(a.InverseMatrix() * a, identity);
+
+  Complex det = a.Determinant();
+  Complex expected = 0;
+  S21MatrixComplex complements = a.CalcComplements();
+  for (int j = 0; j != 4; ++j) expected += a(0, j) * complements(0, j);
+  EXPECT_NEAR(std::abs(det - expected), 0, 1e-9);
+
+  S21MatrixComplex scaled = a * Complex(0, 1);
+  EXPECT_EQ(scaled * Complex(0, -1), a);
+  EXPECT_EQ(a.Transpose().Transpose(), a);
+  EXPECT_FALSE(a == a.Transpose());
+}
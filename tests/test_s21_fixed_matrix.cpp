@@ -0,0 +1,85 @@
+#include "../s21_fixed_matrix.h"
+#include "gtest/gtest.h"
+
+constexpr S21FixedMatrix<3, 3> fixed_3x3{2, 5, 7, 6, 3, 4, 5, -2, -3};
+
+static_assert(fixed_3x3.Determinant() == -1);
+static_assert(fixed_3x3.Transpose()(0, 1) == 6);
+static_assert((fixed_3x3 * fixed_3x3.InverseMatrix())(2, 2) == 1);
+
+TEST(test_fixed_matrix, test_constructors) {
+  S21FixedMatrix<2, 3> m;
+  EXPECT_EQ(m.GetRows(), 2);
+  EXPECT_EQ(m.GetCols(), 3);
+  EXPECT_EQ(m(1, 2), 0);
+
+  EXPECT_THROW((S21FixedMatrix<2, 2>{1, 2, 3}), std::invalid_argument);
+#ifndef S21_MATRIX_NO_BOUNDS_CHECK
+  EXPECT_THROW(m(2, 0), std::out_of_range);
+#endif
+}
+
+TEST(test_fixed_matrix, test_arithmetic) {
+  S21FixedMatrix<2, 2> a{4, 2, 9, 0};
+  S21FixedMatrix<2, 2> b{3, 1, -3, 4};
+
+  EXPECT_TRUE(a * b == (S21FixedMatrix<2, 2>{6, 12, 27, 9}));
+  EXPECT_TRUE(a + b == (S21FixedMatrix<2, 2>{7, 3, 6, 4}));
+  EXPECT_TRUE(a - b == (S21FixedMatrix<2, 2>{1, 1, 12, -4}));
+  EXPECT_TRUE(2 * a == a * 2);
+  EXPECT_TRUE(a * 1e-9 == (S21FixedMatrix<2, 2>()));
+
+  S21FixedMatrix<3, 2> c{2, 1, -3, 0, 4, -1};
+  S21FixedMatrix<2, 3> d{5, -1, 6, -3, 0, 7};
+  S21FixedMatrix<3, 3> res = c * d;
+
+  EXPECT_EQ(res(0, 2), 19);
+  EXPECT_EQ(res(1, 0), -15);
+  EXPECT_EQ(res(2, 1), -4);
+}
+
+TEST(test_fixed_matrix, test_determinant) {
+  S21FixedMatrix<4, 4> m4{3, -3, -5, 8, -3, 2, 4, -6,
+                          2, -5, -7, 5, -4, 3, 5, -6};
+  EXPECT_NEAR(m4.Determinant(), 18, PRECISION);
+
+  S21FixedMatrix<5, 5> m5{0, 6,  -2, -1, 5, 0,  0, 0,  -9, -7, 0,  15, 35,
+                          0, 0, 0,  -1, -11, -2, 1, -2, -2, 3, 0,  -2};
+  EXPECT_NEAR(m5.Determinant(), 2480, PRECISION);
+  EXPECT_NEAR(m5.Determinant(), S21Matrix(m5).Determinant(), PRECISION);
+}
+
+TEST(test_fixed_matrix, test_complements_and_inverse) {
+  S21FixedMatrix<3, 3> m{1, 2, 3, 0, 4, 2, 5, 2, 1};
+
+  EXPECT_TRUE(m.CalcComplements() ==
+              (S21FixedMatrix<3, 3>{0, 10, -20, 4, -14, 8, -8, -2, 4}));
+  EXPECT_TRUE(S21Matrix(m.InverseMatrix()) == S21Matrix(m).InverseMatrix());
+
+  S21FixedMatrix<4, 4> singular{1, 2, 3, 4, 2, 4, 6, 8, 0, 1, 0, 1, 1, 1, 1, 1};
+  EXPECT_THROW(singular.InverseMatrix(), std::logic_error);
+
+  S21FixedMatrix<1, 1> one{4};
+  EXPECT_EQ(one.InverseMatrix()(0, 0), 0.25);
+}
+
+TEST(test_fixed_matrix, test_interop) {
+  S21FixedMatrix<2, 2> f{1, 2, 3, 4};
+  S21Matrix m(2, 2);
+  m(0, 0) = 1;
+  m(1, 1) = 1;
+
+  S21Matrix converted(f);
+  EXPECT_EQ(converted(1, 0), 3);
+  EXPECT_TRUE((S21FixedMatrix<2, 2>(converted) == f));
+  EXPECT_THROW((S21FixedMatrix<3, 2>(converted)), std::logic_error);
+
+  EXPECT_TRUE(f * m == converted);
+  EXPECT_TRUE(m * f == converted);
+  EXPECT_EQ((f + m)(1, 1), 5);
+  EXPECT_EQ((m + f)(0, 0), 2);
+  EXPECT_EQ((f - m)(0, 0), 0);
+  EXPECT_EQ((m - f)(0, 1), -2);
+  EXPECT_THROW(S21Matrix(3, 3) - f, std::logic_error);
+  EXPECT_THROW(f + S21Matrix(3, 3), std::logic_error);
+}
@@ -0,0 +1,85 @@
+#include "../s21_matrix_batch.h"
+#include "gtest/gtest.h"
+
+#include <cmath>
+
+S21MatrixBatch batch_fill(int count, int rows, int cols) {
+  S21MatrixBatch res(count, rows, cols);
+  for (int l = 0; l != count; ++l) {
+    for (int i = 0; i != rows; ++i) {
+      for (int j = 0; j != cols; ++j) {
+        res(l, i, j) = std::sin(l * 0.7 + i * 1.3 + j * 0.4) + (i == j) * 2;
+      }
+    }
+  }
+  return res;
+}
+
+TEST(test_batch, test_access) {
+  S21MatrixBatch batch(5, 2, 3);
+  EXPECT_EQ(batch.GetCount(), 5);
+  EXPECT_EQ(batch.GetRows(), 2);
+  EXPECT_EQ(batch.GetCols(), 3);
+
+  S21Matrix m(2, 3);
+  m(1, 2) = 7;
+  m(0, 1) = -1;
+  batch.Set(3, m);
+  EXPECT_EQ(batch.Get(3), m);
+  EXPECT_DOUBLE_EQ(batch(3, 1, 2), 7);
+  EXPECT_DOUBLE_EQ(batch.Lane(0, 1)[3], -1);
+  EXPECT_EQ(batch.Get(0), S21Matrix(2, 3));
+
+  EXPECT_THROW(batch(5, 0, 0), std::out_of_range);
+  EXPECT_THROW(batch(0, 2, 0), std::out_of_range);
+  EXPECT_THROW(batch.Get(-1), std::out_of_range);
+  EXPECT_THROW(batch.Set(0, S21Matrix(3, 2)), std::logic_error);
+  EXPECT_THROW(S21MatrixBatch(0, 1, 1), std::invalid_argument);
+}
+
+TEST(test_batch, test_determinant) {
+  for (int size = 1; size <= 6; ++size) {
+    S21MatrixBatch batch = batch_fill(1037, size, size);
+    std::vector<double> det = batch.Determinant();
+    ASSERT_EQ(det.size(), 1037u);
+    for (int l = 0; l < 1037; l += 17) {
+      EXPECT_NEAR(det[l], batch.Get(l).Determinant(), 1e-9);
+    }
+  }
+  EXPECT_THROW(batch_fill(3, 2, 3).Determinant(), std::logic_error);
+}
+
+TEST(test_batch, test_inverse) {
+  for (int size = 1; size <= 5; ++size) {
+    S21MatrixBatch batch = batch_fill(777, size, size);
+    S21MatrixBatch inverse = batch.InverseMatrix();
+    for (int l = 0; l < 777; l += 13) {
+      EXPECT_EQ(inverse.Get(l), batch.Get(l).InverseMatrix());
+    }
+  }
+
+  S21MatrixBatch singular = batch_fill(10, 3, 3);
+  for (int j = 0; j != 3; ++j) singular(4, 2, j) = singular(4, 0, j) * 2;
+  EXPECT_THROW(singular.InverseMatrix(), std::logic_error);
+  EXPECT_THROW(batch_fill(3, 2, 3).InverseMatrix(), std::logic_error);
+}
+
+TEST(test_batch, test_mul_transpose) {
+  S21MatrixBatch a = batch_fill(1500, 3, 4), b = batch_fill(1500, 4, 2);
+  S21MatrixBatch c = a * b;
+  EXPECT_EQ(c.GetRows(), 3);
+  EXPECT_EQ(c.GetCols(), 2);
+  for (int l = 0; l < 1500; l += 11) {
+    EXPECT_EQ(c.Get(l), a.Get(l) * b.Get(l));
+  }
+
+  S21MatrixBatch t = a.Transpose();
+  EXPECT_EQ(t.GetRows(), 4);
+  for (int l = 0; l < 1500; l += 11) EXPECT_EQ(t.Get(l), a.Get(l).Transpose());
+  EXPECT_EQ(t.Transpose(), a);
+
+  a.MulMatrix(b);
+  EXPECT_EQ(a, c);
+  EXPECT_THROW(a * b, std::logic_error);
+  EXPECT_THROW(b * batch_fill(1499, 2, 2), std::logic_error);
+}
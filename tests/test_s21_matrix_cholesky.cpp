@@ -0,0 +1,65 @@
+#include "../s21_matrix_cholesky.h"
+#include "../s21_matrix_lu.h"
+#include "gtest/gtest.h"
+
+#include <cmath>
+
+S21Matrix spd_fill(int size) {
+  S21Matrix m(size);
+  for (int i = 0; i != size; ++i) {
+    for (int j = 0; j != size; ++j) m(i, j) = std::sin(i * 0.7 + j * 1.3);
+  }
+  S21Matrix res = m.Transpose() * m;
+  for (int i = 0; i != size; ++i) res(i, i) += 1;
+  return res;
+}
+
+TEST(test_cholesky, test_factor) {
+  S21Matrix a(3);
+  a(0, 0) = 4, a(0, 1) = 12, a(0, 2) = -16;
+  a(1, 0) = 12, a(1, 1) = 37, a(1, 2) = -43;
+  a(2, 0) = -16, a(2, 1) = -43, a(2, 2) = 98;
+  S21MatrixCholesky cholesky = a.Cholesky();
+
+  S21Matrix l(3);
+  l(0, 0) = 2, l(1, 0) = 6, l(1, 1) = 1;
+  l(2, 0) = -8, l(2, 1) = 5, l(2, 2) = 3;
+  EXPECT_TRUE(cholesky.L() == l);
+  EXPECT_NEAR(cholesky.Determinant(), 36, 1e-9);
+  EXPECT_NEAR(cholesky.LogDeterminant(), std::log(36), 1e-12);
+
+  std::vector<double> x = cholesky.Solve(std::vector<double>{0, 6, 39});
+  EXPECT_NEAR(x[0], 1, 1e-9);
+  EXPECT_NEAR(x[1], 1, 1e-9);
+  EXPECT_NEAR(x[2], 1, 1e-9);
+
+  EXPECT_THROW(cholesky.Solve(std::vector<double>{1}), std::logic_error);
+  EXPECT_THROW(cholesky.Solve(S21Matrix(2, 2)), std::logic_error);
+  EXPECT_THROW(S21Matrix(2, 3).Cholesky(), std::logic_error);
+
+  a(2, 2) = -98;
+  EXPECT_THROW(a.Cholesky(), std::logic_error);
+}
+
+TEST(test_cholesky, test_blocked) {
+  for (int size : {1, 31, 32, 33, 100, 200}) {
+    S21Matrix a = spd_fill(size);
+    S21MatrixCholesky cholesky = a.Cholesky();
+    const S21Matrix& l = cholesky.L();
+
+    S21Matrix product = l * l.Transpose() - a;
+    for (double value : product) EXPECT_NEAR(value, 0, 1e-9);
+
+    S21Matrix b(size, 3);
+    for (int i = 0; i != size; ++i) b(i, i % 3) = i + 1;
+    S21Matrix residual = a * cholesky.Solve(b) - b;
+    for (double value : residual) EXPECT_NEAR(value, 0, 1e-8);
+
+    double log_det = 0;
+    S21MatrixLu lu = a.Lu();
+    for (int k = 0; k != size; ++k) {
+      log_det += std::log(std::fabs(lu.Packed()(k, k)));
+    }
+    EXPECT_NEAR(cholesky.LogDeterminant(), log_det, 1e-8 * size);
+  }
+}
@@ -0,0 +1,183 @@
+#include "../s21_matrix_kernels.h"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+#include "../s21_matrix_oop.h"
+
+TEST(test_kernels, test_simd_levels) {
+  for (int level = SIMD_SCALAR; level <= SIMD_AVX512; ++level) {
+    const SimdKernels& kernels = simd_kernels(static_cast<SimdLevel>(level));
+    EXPECT_LE(kernels.level, simd_supported_level());
+
+    for (long size : {0L, 1L, 3L, 8L, 17L, 64L, 101L}) {
+      std::vector<double> a(size), b(size);
+      for (long i = 0; i != size; ++i) {
+        a[i] = i * 0.5 - 3;
+        b[i] = (i % 7) * 1e-9 + i;
+      }
+
+      std::vector<double> sum(a), diff(a), scaled(b);
+      kernels.add(sum.data(), b.data(), size);
+      kernels.sub(diff.data(), b.data(), size);
+      kernels.mul_number(scaled.data(), size, 10, PRECISION);
+
+      for (long i = 0; i != size; ++i) {
+        EXPECT_EQ(sum[i], a[i] + b[i]);
+        EXPECT_EQ(diff[i], a[i] - b[i]);
+        EXPECT_EQ(scaled[i], i == 0 ? 0 : b[i] * 10);
+      }
+
+      EXPECT_TRUE(kernels.equal(a.data(), a.data(), size, PRECISION));
+      if (size > 0) {
+        std::vector<double> c(a);
+        c[size - 1] += 1e-3;
+        EXPECT_FALSE(kernels.equal(a.data(), c.data(), size, PRECISION));
+        c[size - 1] = a[size - 1] + 1e-9;
+        EXPECT_TRUE(kernels.equal(a.data(), c.data(), size, PRECISION));
+      }
+    }
+  }
+}
+
+TEST(test_kernels, test_transpose_tiles) {
+  for (int level = SIMD_SCALAR; level <= SIMD_AVX512; ++level) {
+    const SimdKernels& kernels = simd_kernels(static_cast<SimdLevel>(level));
+    int tile = kernels.tile;
+    std::vector<double> a(tile * 11), b(tile * 13, -1);
+    for (int i = 0; i != tile * 11; ++i) a[i] = i;
+
+    kernels.transpose_tile(a.data(), 11, b.data(), 13);
+    for (int i = 0; i != tile; ++i) {
+      for (int j = 0; j != tile; ++j) EXPECT_EQ(b[j * 13 + i], a[i * 11 + j]);
+      EXPECT_EQ(b[i * 13 + tile], -1);
+    }
+  }
+}
+
+TEST(test_kernels, test_batch_kernels) {
+  long count = 37, stride = 41;
+  std::vector<double> a(16 * stride), b(16 * stride);
+  for (long i = 0; i != 16 * stride; ++i) a[i] = (i * 37 % 23) - 11.0;
+
+  const SimdKernels& scalar = simd_kernels(SIMD_SCALAR);
+  for (int level = SIMD_SCALAR; level <= SIMD_AVX512; ++level) {
+    const SimdKernels& kernels = simd_kernels(static_cast<SimdLevel>(level));
+    for (int size = 1; size <= 4; ++size) {
+      std::vector<double> det(count), expected(count), inverse(16 * stride);
+      kernels.batch_determinant(a.data(), size, count, stride, det.data());
+      scalar.batch_determinant(a.data(), size, count, stride, expected.data());
+      for (long l = 0; l != count; ++l) EXPECT_EQ(det[l], expected[l]);
+
+      kernels.batch_inverse(a.data(), size, count, stride, inverse.data(),
+                            det.data());
+      kernels.batch_multiply(a.data(), inverse.data(), size, size, size,
+                             count, stride, b.data(), PRECISION);
+      for (long l = 0; l != count; ++l) {
+        if (det[l] == 0) continue;
+        for (int i = 0; i != size * size; ++i) {
+          EXPECT_NEAR(b[i * stride + l], i % (size + 1) == 0, 1e-9);
+        }
+      }
+    }
+  }
+}
+
+TEST(test_kernels, test_transpose) {
+  for (int rows : {1, 7, 33, 300}) {
+    for (int cols : {1, 9, 64, 517}) {
+      std::vector<double> a(rows * (cols + 3)), b(cols * rows);
+      for (int i = 0; i != rows * (cols + 3); ++i) a[i] = i;
+
+      transpose(a.data(), rows, cols, cols + 3, b.data(), rows);
+      for (int i = 0; i != rows; ++i) {
+        for (int j = 0; j != cols; ++j) {
+          EXPECT_EQ(b[j * rows + i], a[i * (cols + 3) + j]);
+        }
+      }
+
+      std::vector<double> c(a.begin(), a.begin() + rows * cols);
+      transpose_cycles(c.data(), rows, cols);
+      for (int i = 0; i != rows * cols; ++i) {
+        EXPECT_EQ(c[i], a[i / rows + (i % rows) * cols]);
+      }
+    }
+  }
+
+  for (int size : {1, 5, 32, 70}) {
+    std::vector<double> a(size * (size + 2));
+    for (int i = 0; i != size * (size + 2); ++i) a[i] = i;
+
+    std::vector<double> b(a);
+    transpose_in_place(b.data(), size, size + 2);
+    for (int i = 0; i != size; ++i) {
+      for (int j = 0; j != size; ++j) {
+        EXPECT_EQ(b[i * (size + 2) + j], a[j * (size + 2) + i]);
+      }
+      EXPECT_EQ(b[i * (size + 2) + size], a[i * (size + 2) + size]);
+    }
+  }
+}
+
+TEST(test_kernels, test_float_kernels) {
+  for (int level = SIMD_SCALAR; level <= SIMD_AVX512; ++level) {
+    const SimdKernels& kernels = simd_kernels(static_cast<SimdLevel>(level));
+
+    for (long size : {0L, 1L, 3L, 8L, 17L, 64L, 101L}) {
+      std::vector<float> a(size), b(size);
+      for (long i = 0; i != size; ++i) {
+        a[i] = i * 0.5f - 3;
+        b[i] = (i % 7) * 1e-6f + i;
+      }
+
+      std::vector<float> sum(a), diff(a), scaled(b);
+      kernels.add_float(sum.data(), b.data(), size);
+      kernels.sub_float(diff.data(), b.data(), size);
+      kernels.mul_number_float(scaled.data(), size, 10, 1e-4f);
+
+      for (long i = 0; i != size; ++i) {
+        EXPECT_EQ(sum[i], a[i] + b[i]);
+        EXPECT_EQ(diff[i], a[i] - b[i]);
+        EXPECT_EQ(scaled[i], i == 0 ? 0 : b[i] * 10);
+      }
+
+      EXPECT_TRUE(kernels.equal_float(a.data(), a.data(), size, 1e-4f));
+      if (size > 0) {
+        std::vector<float> c(a);
+        c[size - 1] += 1e-2f;
+        EXPECT_FALSE(kernels.equal_float(a.data(), c.data(), size, 1e-4f));
+      }
+    }
+  }
+}
+
+TEST(test_kernels, test_gemm_kernels) {
+  int kc = 13;
+  std::vector<double> a(GEMM_MR * kc), b(GEMM_NR * kc);
+  std::vector<float> fa(GEMM_MR * kc), fb(GEMM_NR_FLOAT * kc);
+  for (int i = 0; i != GEMM_MR * kc; ++i) fa[i] = a[i] = i % 7 - 3;
+  for (int i = 0; i != GEMM_NR * kc; ++i) b[i] = i % 5 - 2;
+  for (int i = 0; i != GEMM_NR_FLOAT * kc; ++i) fb[i] = i % 5 - 2;
+
+  const SimdKernels& scalar = simd_kernels(SIMD_SCALAR);
+  for (int level = SIMD_SCALAR; level <= SIMD_AVX512; ++level) {
+    const SimdKernels& kernels = simd_kernels(static_cast<SimdLevel>(level));
+    for (int mr : {1, GEMM_MR}) {
+      for (int nr : {3, GEMM_NR}) {
+        std::vector<double> c(GEMM_MR * 20, 1), expected(c);
+        kernels.gemm_kernel(kc, 2, a.data(), b.data(), c.data(), 20, mr, nr);
+        scalar.gemm_kernel(kc, 2, a.data(), b.data(), expected.data(), 20, mr,
+                           nr);
+        EXPECT_EQ(c, expected);
+      }
+      for (int nr : {5, GEMM_NR_FLOAT}) {
+        std::vector<float> c(GEMM_MR * 20, 1), expected(c);
+        kernels.gemm_kernel_float(kc, 2, fa.data(), fb.data(), c.data(), 20,
+                                  mr, nr);
+        scalar.gemm_kernel_float(kc, 2, fa.data(), fb.data(), expected.data(),
+                                 20, mr, nr);
+        EXPECT_EQ(c, expected);
+      }
+    }
+  }
+}
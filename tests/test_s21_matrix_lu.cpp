@@ -0,0 +1,77 @@
+#include "../s21_matrix_lu.h"
+#include "gtest/gtest.h"
+
+#include <cmath>
+
+S21Matrix lu_fill(int rows, int cols) {
+  S21Matrix res(rows, cols);
+  for (int i = 0; i != rows; ++i) {
+    for (int j = 0; j != cols; ++j) res(i, j) = std::sin(i * 0.7 + j * 1.3);
+  }
+  return res;
+}
+
+TEST(test_lu, test_factor) {
+  S21Matrix a(3);
+  a(0, 0) = 2, a(0, 1) = 1, a(0, 2) = 1;
+  a(1, 0) = 4, a(1, 1) = -6, a(1, 2) = 0;
+  a(2, 0) = -2, a(2, 1) = 7, a(2, 2) = 2;
+  S21MatrixLu lu = a.Lu();
+
+  EXPECT_EQ(lu.GetSize(), 3);
+  EXPECT_EQ(lu.Pivots()[0], 1);
+  EXPECT_FALSE(lu.IsSingular());
+  EXPECT_NEAR(lu.Determinant(), -16, 1e-12);
+  EXPECT_NEAR(lu.Packed()(0, 0), 4, 1e-12);
+
+  std::vector<double> x = lu.Solve(std::vector<double>{5, -2, 9});
+  EXPECT_NEAR(x[0], 1, 1e-12);
+  EXPECT_NEAR(x[1], 1, 1e-12);
+  EXPECT_NEAR(x[2], 2, 1e-12);
+
+  EXPECT_TRUE(lu.Inverse() == a.InverseMatrix());
+  EXPECT_THROW(lu.Solve(std::vector<double>{1, 2}), std::logic_error);
+  EXPECT_THROW(lu.Solve(S21Matrix(2, 3)), std::logic_error);
+  EXPECT_THROW(S21Matrix(2, 3).Lu(), std::logic_error);
+}
+
+TEST(test_lu, test_solve_blocked) {
+  for (int size : {1, 31, 32, 33, 100, 200}) {
+    S21Matrix a = lu_fill(size, size);
+    for (int i = 0; i != size; ++i) a(i, i) += 2;
+    S21Matrix b = lu_fill(size, 7);
+    S21MatrixLu lu = a.Lu();
+
+    S21Matrix residual = a * lu.Solve(b) - b;
+    for (double value : residual) EXPECT_NEAR(value, 0, 1e-9);
+
+    S21Matrix identity = a * lu.Inverse();
+    for (int i = 0; i != size; ++i) {
+      for (int j = 0; j != size; ++j) {
+        EXPECT_NEAR(identity(i, j), i == j, 1e-9);
+      }
+    }
+
+    std::vector<double> column(size);
+    for (int i = 0; i != size; ++i) column[i] = b(i, 3);
+    std::vector<double> x = lu.Solve(column);
+    S21Matrix xs = lu.Solve(b);
+    for (int i = 0; i != size; ++i) EXPECT_NEAR(x[i], xs(i, 3), 1e-9);
+  }
+}
+
+TEST(test_lu, test_singular) {
+  S21Matrix a = lu_fill(64, 64);
+  for (int j = 0; j != 64; ++j) a(40, j) = 2 * a(3, j) - a(17, j);
+  S21MatrixLu lu = a.Lu();
+
+  EXPECT_TRUE(lu.IsSingular());
+  EXPECT_NEAR(lu.Determinant(), 0, 1e-6);
+  EXPECT_THROW(lu.Inverse(), std::logic_error);
+  EXPECT_THROW(lu.Solve(std::vector<double>(64, 1)), std::logic_error);
+  EXPECT_THROW(a.InverseMatrix(), std::logic_error);
+
+  S21Matrix zero(40);
+  EXPECT_EQ(zero.Lu().Determinant(), 0);
+  EXPECT_EQ(zero.Determinant(), 0);
+}
@@ -1,6 +1,24 @@
 #include "../s21_matrix_oop.h"
 #include "gtest/gtest.h"
 
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <sstream>
+
+long array_allocations = 0;
+
+double* counting_allocate(long size) {
+  ++array_allocations;
+  return S21Matrix::DefaultAllocator().allocate(size);
+}
+
+void counting_deallocate(double* ptr, long size) {
+  S21Matrix::DefaultAllocator().deallocate(ptr, size);
+}
+
 TEST(test_contructors, test_basic_con) {
   S21Matrix m;
   EXPECT_EQ(m.GetRows(), 0);
@@ -563,3 +581,1100 @@ TEST(test_operators, test_multiplyequal) {
 
   EXPECT_TRUE(m1 == m2);
 }
+
+TEST(test_operations, test_determinant_4) {
+  S21Matrix m1(4, 4);
+
+  for (int i = 0; i != 4; ++i) {
+    for (int j = 0; j != 4; ++j) {
+      m1[i][j] = i == j ? 2 : (i + j) % 3;
+    }
+  }
+
+  S21Matrix m2(5, 5);
+  for (int i = 0; i != 4; ++i) {
+    for (int j = 0; j != 4; ++j) {
+      m2[i][j] = m1[i][j];
+    }
+  }
+  m2[4][4] = 1;
+
+  EXPECT_NEAR(m1.Determinant(), m2.Determinant(), PRECISION);
+}
+
+TEST(test_operations, test_determinant_5) {
+  int size = 50;
+  S21Matrix m1(size, size);
+
+  for (int i = 0; i != size; ++i) {
+    m1[i][i] = 2;
+    if (i > 0) m1[i][i - 1] = -1;
+    if (i < size - 1) m1[i][i + 1] = -1;
+  }
+
+  EXPECT_NEAR(m1.Determinant(), size + 1, 1e-9);
+}
+
+TEST(test_operations, test_determinant_6) {
+  S21Matrix m1(6, 6);
+
+  for (int i = 0; i != 6; ++i) {
+    for (int j = 0; j != 6; ++j) {
+      m1[i][j] = i * 6 + j + 1;
+    }
+  }
+
+  EXPECT_NEAR(m1.Determinant(), 0, PRECISION);
+}
+
+TEST(test_operations, test_determinant_7) {
+  S21Matrix m1(5, 5);
+
+  for (int i = 0; i != 5; ++i) {
+    m1[i][4 - i] = i + 1;
+  }
+
+  EXPECT_NEAR(m1.Determinant(), 120, PRECISION);
+}
+
+TEST(test_operations, test_inverse_5) {
+  S21Matrix m1(3, 3);
+
+  for (int i = 0; i != 3; ++i) {
+    for (int j = 0; j != 3; ++j) {
+      m1[i][j] = i * 3 + j + 1;
+    }
+  }
+
+  EXPECT_THROW(m1.InverseMatrix(), std::logic_error);
+}
+
+TEST(test_operations, test_inverse_6) {
+  int size = 60;
+  S21Matrix m1(size, size);
+  S21Matrix identity(size, size);
+
+  for (int i = 0; i != size; ++i) {
+    identity[i][i] = 1;
+    for (int j = 0; j != size; ++j) {
+      m1[i][j] = i == j ? size : ((i * 7 + j * 3) % 11) - 5;
+    }
+  }
+
+  double cond = 0;
+  S21Matrix inverse = m1.InverseMatrix(cond);
+
+  EXPECT_TRUE(m1 * inverse == identity);
+  EXPECT_GE(cond, 1);
+  EXPECT_LT(cond, 100);
+}
+
+TEST(test_operations, test_inverse_7) {
+  S21Matrix m1(2, 2);
+  m1[0][1] = 4;
+  m1[1][0] = 2;
+
+  double cond = 0;
+  S21Matrix inverse = m1.InverseMatrix(cond);
+
+  EXPECT_NEAR(inverse[0][1], 0.5, PRECISION);
+  EXPECT_NEAR(inverse[1][0], 0.25, PRECISION);
+  EXPECT_NEAR(inverse[0][0], 0, PRECISION);
+  EXPECT_NEAR(cond, 2, PRECISION);
+}
+
+S21Matrix complements_by_definition(const S21Matrix& m) {
+  int size = m.GetRows();
+  S21Matrix res(size, size);
+
+  for (int i = 0; i != size; ++i) {
+    for (int j = 0; j != size; ++j) {
+      S21Matrix minor(size - 1, size - 1);
+      for (int r = 0, mr = 0; r != size; ++r) {
+        if (r == i) continue;
+        for (int c = 0, mc = 0; c != size; ++c) {
+          if (c == j) continue;
+          minor[mr][mc++] = m[r][c];
+        }
+        ++mr;
+      }
+      res[i][j] = ((i + j) % 2 ? -1 : 1) * minor.Determinant();
+    }
+  }
+  return res;
+}
+
+TEST(test_operations, test_calccomplements_4) {
+  S21Matrix m1(3, 3);
+
+  for (int i = 0; i != 3; ++i) {
+    for (int j = 0; j != 3; ++j) {
+      m1[i][j] = i * 3 + j + 1;
+    }
+  }
+
+  EXPECT_TRUE(m1.CalcComplements() == complements_by_definition(m1));
+}
+
+TEST(test_operations, test_calccomplements_5) {
+  S21Matrix m1(4, 4);
+  double rows[3][4] = {{2, 1, 0, 3}, {1, 4, 2, 0}, {0, 1, 1, 2}};
+
+  for (int j = 0; j != 4; ++j) {
+    m1[0][j] = rows[0][j];
+    m1[1][j] = rows[1][j];
+    m1[2][j] = rows[0][j] + rows[1][j];
+    m1[3][j] = rows[2][j];
+  }
+
+  S21Matrix res = m1.CalcComplements();
+
+  EXPECT_TRUE(res == complements_by_definition(m1));
+  EXPECT_GT(fabs(res[2][0]) + fabs(res[2][1]), 1);
+}
+
+TEST(test_operations, test_calccomplements_6) {
+  S21Matrix m1(5, 5);
+
+  for (int i = 0; i != 5; ++i) {
+    for (int j = 0; j != 5; ++j) {
+      m1[i][j] = (i % 3 + 1) * (j + 1);
+    }
+  }
+
+  EXPECT_TRUE(m1.CalcComplements() == S21Matrix(5, 5));
+}
+
+TEST(test_operations, test_calccomplements_7) {
+  int size = 30;
+  S21Matrix m1(size, size);
+  S21Matrix expect(size, size);
+
+  for (int i = 0; i != size; ++i) {
+    for (int j = 0; j != size; ++j) {
+      m1[i][j] = i == j ? 4 : ((i * 5 + j * 3) % 7 - 3) * 0.1;
+    }
+  }
+
+  double det = m1.Determinant();
+  for (int i = 0; i != size; ++i) {
+    expect[i][i] = 1;
+  }
+
+  S21Matrix res = m1 * m1.CalcComplements().Transpose();
+  res *= 1 / det;
+
+  EXPECT_TRUE(res == expect);
+}
+
+TEST(test_operations, test_calccomplements_8) {
+  S21Matrix m1(6, 6);
+
+  for (int i = 0; i != 6; ++i) {
+    for (int j = 0; j != 6; ++j) {
+      m1[i][j] = (i * 7 + j * 5) % 9 - 4;
+    }
+  }
+
+  S21Matrix res = m1.CalcComplements();
+  S21Matrix expect = complements_by_definition(m1);
+
+  for (int i = 0; i != 6; ++i) {
+    for (int j = 0; j != 6; ++j) {
+      EXPECT_NEAR(res[i][j], expect[i][j], 1e-6 * (1 + fabs(expect[i][j])));
+    }
+  }
+}
+
+TEST(test_operations, test_mulmatrix_blocked) {
+  int m = 101, k = 300, n = 67;
+  S21Matrix m1(m, k);
+  S21Matrix m2(k, n);
+  S21Matrix expect(m, n);
+
+  for (int i = 0; i != m; ++i) {
+    for (int j = 0; j != k; ++j) {
+      m1[i][j] = (i * 7 + j * 3) % 13 - 6;
+    }
+  }
+  for (int i = 0; i != k; ++i) {
+    for (int j = 0; j != n; ++j) {
+      m2[i][j] = (i * 5 + j * 11) % 17 - 8;
+    }
+  }
+  for (int i = 0; i != m; ++i) {
+    for (int j = 0; j != n; ++j) {
+      for (int p = 0; p != k; ++p) {
+        expect[i][j] += m1[i][p] * m2[p][j];
+      }
+    }
+  }
+
+  m1.MulMatrix(m2);
+
+  EXPECT_EQ(m1.GetRows(), m);
+  EXPECT_EQ(m1.GetCols(), n);
+  EXPECT_TRUE(m1 == expect);
+}
+
+TEST(test_operations, test_mulmatrix_flush) {
+  S21Matrix m1(1, 2);
+  S21Matrix m2(2, 1);
+
+  m1[0][0] = 1e-4;
+  m1[0][1] = 1;
+  m2[0][0] = 1e-4;
+  m2[1][0] = 1;
+
+  m1.MulMatrix(m2);
+  EXPECT_NEAR(m1[0][0], 1 + 1e-8, 1e-12);
+
+  m2[1][0] = 0;
+  S21Matrix m3(1, 2);
+  m3[0][0] = 1e-4;
+  m3.MulMatrix(m2);
+  EXPECT_EQ(m3[0][0], 0);
+}
+
+TEST(test_threads, test_thread_count) {
+  EXPECT_THROW(S21Matrix::SetThreadCount(-1), std::invalid_argument);
+
+  S21Matrix::SetThreadCount(3);
+  EXPECT_EQ(S21Matrix::GetThreadCount(), 3);
+
+  S21Matrix::SetThreadCount(0);
+  EXPECT_GE(S21Matrix::GetThreadCount(), 1);
+}
+
+TEST(test_threads, test_deterministic_results) {
+  int size = 300;
+  S21Matrix m1(size, size);
+  S21Matrix m2(size, size);
+
+  for (int i = 0; i != size; ++i) {
+    for (int j = 0; j != size; ++j) {
+      m1[i][j] = ((i * 13 + j * 7) % 19 - 9) * 0.37 / size + (i == j);
+      m2[i][j] = ((i * 3 + j * 11) % 23 - 11) * 0.21;
+    }
+  }
+
+  S21Matrix expect[6];
+  for (int threads : {1, 4, 7}) {
+    S21Matrix::SetThreadCount(threads);
+
+    S21Matrix res[6] = {m1 * m2,           m1 + m2,
+                        m1 * 0.5,          m2.Transpose(),
+                        m1.InverseMatrix(), m1.CalcComplements()};
+    double det = m1.Determinant();
+
+    if (threads == 1) {
+      for (int i = 0; i != 6; ++i) expect[i] = res[i];
+      expect[5] *= 1 / det;
+    } else {
+      res[5] *= 1 / det;
+      for (int i = 0; i != 6; ++i) {
+        for (int r = 0; r != res[i].GetRows(); ++r) {
+          for (int c = 0; c != res[i].GetCols(); ++c) {
+            ASSERT_EQ(res[i][r][c], expect[i][r][c]);
+          }
+        }
+      }
+      EXPECT_TRUE(res[0] == expect[0]);
+    }
+  }
+
+  S21Matrix::SetThreadCount(0);
+}
+
+TEST(test_operators, test_expression_chain) {
+  S21Matrix a(2, 3);
+  S21Matrix b(2, 3);
+  S21Matrix c(2, 3);
+  S21Matrix expect(2, 3);
+
+  for (int i = 0; i != 2; ++i) {
+    for (int j = 0; j != 3; ++j) {
+      a[i][j] = i + j;
+      b[i][j] = i * j - 1;
+      c[i][j] = 0.5 * j;
+      expect[i][j] = a[i][j] + b[i][j] - c[i][j] * 2.0;
+    }
+  }
+
+  S21Matrix res = a + b - c * 2.0;
+  EXPECT_TRUE(res == expect);
+
+  res = 2 * (a - b) + b * 2;
+  EXPECT_TRUE(res == 2 * a);
+
+  res -= a + a;
+  EXPECT_TRUE(res == S21Matrix(2, 3));
+
+  res += a - b;
+  EXPECT_TRUE(res == a - b);
+}
+
+TEST(test_operators, test_expression_aliasing) {
+  S21Matrix a(3, 3);
+  S21Matrix b(2, 2);
+
+  for (int i = 0; i != 3; ++i) {
+    for (int j = 0; j != 3; ++j) {
+      a[i][j] = i * 3 + j;
+    }
+  }
+
+  S21Matrix expect(a);
+  expect *= 3;
+
+  a = a + a * 2;
+  EXPECT_TRUE(a == expect);
+
+  b = a - a;
+  EXPECT_EQ(b.GetRows(), 3);
+  EXPECT_TRUE(b == S21Matrix(3, 3));
+}
+
+TEST(test_operators, test_expression_flush) {
+  S21Matrix a(1, 2);
+  a[0][0] = 1e-8;
+  a[0][1] = 1;
+
+  S21Matrix res = a * 2 + a;
+
+  EXPECT_EQ(res[0][0], 1e-8);
+  EXPECT_EQ(res[0][1], 3);
+}
+
+TEST(test_operators, test_expression_errors) {
+  S21Matrix a(2, 2);
+  S21Matrix b(2, 3);
+  S21Matrix c(3, 2);
+
+  EXPECT_THROW(a + b - b, std::logic_error);
+  EXPECT_THROW(a - b * 2, std::logic_error);
+  EXPECT_THROW(a += b * 2, std::logic_error);
+
+  S21Matrix res = (b + b) * c;
+  EXPECT_EQ(res.GetRows(), 2);
+  EXPECT_EQ(res.GetCols(), 2);
+}
+
+TEST(test_operators, test_expression_as_matrix) {
+  S21Matrix a(2, 2);
+  S21Matrix b(2, 2);
+  a[0][0] = 1;
+  a[0][1] = 2;
+  a[1][0] = 3;
+  a[1][1] = 4;
+  b[0][1] = 1;
+
+  EXPECT_EQ((a + b)(0, 1), 3);
+#ifndef S21_MATRIX_NO_BOUNDS_CHECK
+  EXPECT_THROW((a + b)(2, 0), std::out_of_range);
+#endif
+  EXPECT_TRUE((a + b).Transpose() == a.Transpose() + b.Transpose());
+  EXPECT_EQ((a * 2.0).Determinant(), -8);
+  EXPECT_TRUE((a - b).InverseMatrix() == S21Matrix(a - b).InverseMatrix());
+  EXPECT_TRUE((a * 1.0).CalcComplements() == a.CalcComplements());
+  EXPECT_TRUE(a + b == (a + b).Eval());
+  EXPECT_FALSE(a - b == a);
+
+  std::ostringstream expr_out, matrix_out;
+  expr_out << a - b;
+  matrix_out << S21Matrix(a - b);
+  EXPECT_EQ(expr_out.str(), matrix_out.str());
+}
+
+TEST(test_operators, test_expression_chunks) {
+  S21Matrix::SetThreadCount(4);
+
+  for (int cols : {3, 300}) {
+    S21Matrix a(257, cols);
+    S21Matrix b(257, cols);
+    for (int i = 0; i != 257; ++i) {
+      for (int j = 0; j != cols; ++j) {
+        a[i][j] = i - j;
+        b[i][j] = 0.5 * i * j;
+      }
+    }
+
+    S21Matrix expect(a);
+    expect.SubMatrix(S21Matrix(b * 3));
+    S21Matrix res = a - b * 3;
+    EXPECT_TRUE(res == expect);
+
+    res += a;
+    expect.SumMatrix(a);
+    EXPECT_TRUE(res == expect);
+
+    S21Matrix old(b);
+    b = a - b;
+    expect = a;
+    expect.SubMatrix(old);
+    EXPECT_TRUE(b == expect);
+  }
+
+  S21Matrix::SetThreadCount(0);
+}
+
+TEST(test_operators, test_expression_arguments) {
+  S21Matrix a(2, 2);
+  S21Matrix b(2, 2);
+  a[0][0] = 1;
+  a[0][1] = 2;
+  a[1][0] = 3;
+  a[1][1] = 4;
+  b[0][0] = 1;
+  b[1][1] = -1;
+
+  S21Matrix m(a);
+  EXPECT_TRUE(m.EqMatrix(a * 1.0));
+  EXPECT_FALSE(m.EqMatrix(a * 2.0));
+
+  m.SumMatrix(a + b);
+  EXPECT_TRUE(m == a * 2 + b);
+  m.SubMatrix(a - b);
+  EXPECT_TRUE(m == a + b * 2);
+
+  S21Matrix expect = S21Matrix(a + b) * S21Matrix(a - b);
+  m = a + b;
+  m.MulMatrix(a - b);
+  EXPECT_TRUE(m == expect);
+
+  m = a + b;
+  m *= a - b;
+  EXPECT_TRUE(m == expect);
+  EXPECT_TRUE((a + b) * (a - b) == expect);
+  EXPECT_TRUE(S21Matrix(a + b) * (a - b) == expect);
+
+  m = a;
+  m.MulMatrix(m + m);
+  EXPECT_TRUE(m == a * a * 2);
+  EXPECT_THROW(m.SumMatrix(S21Matrix(3, 2) + S21Matrix(3, 2)),
+               std::logic_error);
+}
+
+TEST(test_operators, test_rvalue_allocations) {
+  S21Matrix a(4, 4);
+  S21Matrix b(4, 4);
+  S21Matrix c(4, 4);
+
+  for (int i = 0; i != 4; ++i) {
+    for (int j = 0; j != 4; ++j) {
+      a[i][j] = i + j;
+      b[i][j] = i - j;
+      c[i][j] = i * j;
+    }
+  }
+
+  S21Matrix expect = a + b + c;
+  S21Matrix::SetAllocator({counting_allocate, counting_deallocate});
+
+  long before = array_allocations;
+  S21Matrix res = (a + b) + c;
+  EXPECT_EQ(array_allocations - before, 1);
+  EXPECT_TRUE(res == expect);
+
+  before = array_allocations;
+  res = a.Transpose() + b + c;
+  EXPECT_EQ(array_allocations - before, 1);
+
+  before = array_allocations;
+  res = c - a.Transpose() * 2;
+  EXPECT_EQ(array_allocations - before, 1);
+  EXPECT_TRUE(res == c - 2 * a);
+
+  before = array_allocations;
+  res = 2 * (a * b) - c;
+  EXPECT_EQ(array_allocations - before, 1);
+
+  before = array_allocations;
+  res = (a * b + c) * c;
+  EXPECT_EQ(array_allocations - before, 2);
+
+  S21Matrix::SetAllocator(S21Matrix::DefaultAllocator());
+}
+
+TEST(test_allocator, test_aligned_storage) {
+  for (int size : {1, 3, 7, 33, 200}) {
+    S21Matrix m(size, size + 1);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(m[0]) % S21_MATRIX_ALIGNMENT, 0u);
+    EXPECT_EQ(m[size - 1][size], 0);
+  }
+}
+
+TEST(test_allocator, test_buffer_reuse) {
+  double* first = nullptr;
+  {
+    S21Matrix m(10, 10);
+    first = m[0];
+  }
+
+  S21Matrix m(12, 9, S21Matrix::Uninitialized());
+  EXPECT_EQ(m[0], first);
+  EXPECT_EQ(m.GetRows(), 12);
+  EXPECT_EQ(m.GetCols(), 9);
+
+  S21Matrix zero(12, 9);
+  EXPECT_EQ(zero[11][8], 0);
+  EXPECT_THROW(S21Matrix(0, 1, S21Matrix::Uninitialized()),
+               std::invalid_argument);
+}
+
+TEST(test_allocator, test_custom_allocator) {
+  EXPECT_THROW(S21Matrix::SetAllocator({nullptr, counting_deallocate}),
+               std::invalid_argument);
+
+  S21Matrix before(2, 2);
+  before[1][1] = 5;
+
+  S21Matrix::SetAllocator({counting_allocate, counting_deallocate});
+  EXPECT_EQ(S21Matrix::GetAllocator().allocate, counting_allocate);
+
+  long count = array_allocations;
+  S21Matrix copy(before);
+  S21Matrix::SetAllocator(S21Matrix::DefaultAllocator());
+  S21Matrix other(copy);
+
+  EXPECT_EQ(array_allocations - count, 1);
+  EXPECT_EQ(other[1][1], 5);
+  EXPECT_EQ(S21Matrix::GetAllocator().allocate,
+            S21Matrix::DefaultAllocator().allocate);
+}
+
+double* failing_allocate(long) { throw std::bad_alloc(); }
+
+TEST(test_allocator, test_failing_allocator) {
+  S21Matrix source(3, 3);
+
+  for (int i = 0; i != 3; ++i) {
+    S21Matrix::SetAllocator({failing_allocate, counting_deallocate});
+  }
+  EXPECT_THROW(S21Matrix copy(source), std::bad_alloc);
+  EXPECT_THROW(S21Matrix(2, 2), std::bad_alloc);
+
+  S21Matrix::SetAllocator(S21Matrix::DefaultAllocator());
+  S21Matrix copy(source);
+  EXPECT_TRUE(copy == source);
+}
+
+long adopted_releases = 0;
+
+double* adopted_allocate(long size) { return new double[size]; }
+
+void adopted_deallocate(double* ptr, long) {
+  ++adopted_releases;
+  delete[] ptr;
+}
+
+TEST(test_view, test_block) {
+  S21Matrix m(4, 5);
+  for (int i = 0; i != 20; ++i) m[0][i] = i;
+
+  S21MatrixView block = m.Block(1, 2, 2, 3);
+  EXPECT_EQ(block.GetRows(), 2);
+  EXPECT_EQ(block.GetCols(), 3);
+  EXPECT_EQ(block.GetStride(), 5);
+  EXPECT_FALSE(block.IsContiguous());
+  EXPECT_EQ(block(0, 0), 7);
+  EXPECT_EQ(block[1][2], 14);
+
+  block(1, 1) = -1;
+  EXPECT_EQ(m[2][3], -1);
+
+  EXPECT_THROW(m.Block(3, 0, 2, 1), std::out_of_range);
+  EXPECT_THROW(m.Block(0, -1, 1, 1), std::out_of_range);
+#ifndef S21_MATRIX_NO_BOUNDS_CHECK
+  EXPECT_THROW(block(2, 0), std::out_of_range);
+#endif
+  EXPECT_THROW(S21MatrixView(m[0], 2, 3, 2), std::invalid_argument);
+  EXPECT_EQ(m.Block(4, 5, 0, 0).GetRows(), 0);
+}
+
+TEST(test_view, test_block_arithmetic) {
+  S21Matrix m(4, 4), ones(2, 2);
+  for (int i = 0; i != 16; ++i) m[0][i] = i;
+  for (int i = 0; i != 4; ++i) ones[0][i] = 1;
+
+  m.Block(2, 2, 2, 2).SumMatrix(ones);
+  m.Block(0, 0, 2, 2).SubMatrix(m.Block(2, 0, 2, 2));
+  m.Block(0, 2, 2, 2).MulNumber(2);
+
+  S21Matrix expected(4, 4);
+  double values[] = {-8, -8, 4, 6, -8, -8, 12, 14,
+                     8,  9,  11, 12, 12, 13, 15, 16};
+  for (int i = 0; i != 16; ++i) expected[0][i] = values[i];
+  EXPECT_TRUE(m == expected);
+  EXPECT_TRUE(m.Block(2, 0, 2, 2) == S21MatrixView(expected).Block(2, 0, 2, 2));
+  EXPECT_FALSE(m.Block(0, 0, 2, 2).EqMatrix(m.Block(2, 2, 2, 2)));
+
+  S21Matrix copy(m.Block(1, 1, 2, 3));
+  EXPECT_EQ(copy.GetRows(), 2);
+  EXPECT_EQ(copy.GetCols(), 3);
+  EXPECT_EQ(copy[1][2], 12);
+
+  m.Block(0, 0, 2, 3).Assign(copy);
+  EXPECT_EQ(m[1][2], 12);
+  EXPECT_THROW(m.Block(0, 0, 2, 2).SumMatrix(copy), std::logic_error);
+}
+
+TEST(test_view, test_block_operators) {
+  S21Matrix m(5, 600), b(2, 300);
+  for (int i = 0; i != 5; ++i) {
+    for (int j = 0; j != 600; ++j) m[i][j] = i * 600 + j;
+  }
+  for (int i = 0; i != 2; ++i) {
+    for (int j = 0; j != 300; ++j) b[i][j] = j - i;
+  }
+
+  S21MatrixView block = m.Block(1, 250, 2, 300);
+  S21Matrix dense(block);
+  EXPECT_TRUE(block + b == dense + b);
+  EXPECT_TRUE(b - block * 2 == b - dense * 2);
+  EXPECT_TRUE(0.5 * block - block == dense * -0.5);
+
+  S21Matrix res = S21Matrix(block) + b;
+  res -= block;
+  EXPECT_TRUE(res == b);
+  EXPECT_THROW(block + m, std::logic_error);
+
+  S21Matrix product = (b + block) * m.Block(0, 0, 5, 300).Transpose();
+  EXPECT_TRUE(product == (b + dense) * m.Block(0, 0, 5, 300).Transpose());
+  EXPECT_EQ(product.GetCols(), 5);
+  EXPECT_THROW(b + m.Block(0, 0, 3, 300), std::logic_error);
+}
+
+TEST(test_view, test_block_product) {
+  S21Matrix a(6, 7), b(7, 5);
+  for (int i = 0; i != 42; ++i) a[0][i] = (i % 5) - 2;
+  for (int i = 0; i != 35; ++i) b[0][i] = (i % 3) + 0.5;
+
+  S21MatrixView left = a.Block(1, 2, 4, 3), right = b.Block(3, 1, 3, 4);
+  S21Matrix res = left * right;
+  S21Matrix expected = S21Matrix(left) * S21Matrix(right);
+  EXPECT_TRUE(res == expected);
+
+  S21Matrix dense(left);
+  dense.MulMatrix(right);
+  EXPECT_TRUE(dense == expected);
+  EXPECT_THROW(left * left, std::logic_error);
+
+  S21Matrix transposed = left.Transpose();
+  EXPECT_EQ(transposed.GetRows(), 3);
+  EXPECT_EQ(transposed[2][3], left[3][2]);
+}
+
+TEST(test_view, test_block_determinant) {
+  S21Matrix m(8, 8);
+  for (int i = 0; i != 8; ++i) {
+    for (int j = 0; j != 8; ++j) m[i][j] = i == j ? 4 : 1.0 / (i + j + 1);
+  }
+
+  for (int size : {2, 4, 6}) {
+    S21MatrixView block = m.Block(1, 2, size, size);
+    S21Matrix dense(block);
+    EXPECT_NEAR(block.Determinant(), dense.Determinant(), 1e-9);
+    EXPECT_TRUE(block.InverseMatrix() == dense.InverseMatrix());
+    EXPECT_TRUE(block.CalcComplements() == dense.CalcComplements());
+  }
+
+  EXPECT_THROW(m.Block(0, 0, 2, 3).Determinant(), std::logic_error);
+  EXPECT_THROW(m.Block(0, 0, 2, 3).InverseMatrix(), std::logic_error);
+}
+
+TEST(test_view, test_adopt_buffer) {
+  double borrowed[6] = {1, 2, 3, 4, 5, 6};
+  {
+    S21Matrix m(borrowed, 2, 3);
+    EXPECT_EQ(m[1][0], 4);
+    m.MulNumber(2);
+
+    S21Matrix copy(m);
+    EXPECT_NE(copy[0], m[0]);
+  }
+  EXPECT_EQ(borrowed[5], 12);
+
+  S21MatrixAllocator owner = {adopted_allocate, adopted_deallocate};
+  long releases = adopted_releases;
+  {
+    S21Matrix m(adopted_allocate(4), 2, 2, &owner);
+    m[1][1] = 3;
+    S21Matrix moved(std::move(m));
+    EXPECT_EQ(moved[1][1], 3);
+  }
+  EXPECT_EQ(adopted_releases - releases, 1);
+
+  EXPECT_THROW(S21Matrix(nullptr, 2, 2), std::invalid_argument);
+  EXPECT_THROW(S21Matrix(borrowed, 0, 2), std::invalid_argument);
+}
+
+TEST(test_access, test_unchecked_access) {
+  S21Matrix m(3, 4);
+  for (int i = 0; i != 12; ++i) m.Data()[i] = i;
+
+  EXPECT_EQ(m.AtUnchecked(2, 1), 9);
+  EXPECT_EQ(m.RowPtr(1)[3], 7);
+  m.AtUnchecked(0, 2) = -1;
+  EXPECT_EQ(m(0, 2), -1);
+
+  const S21Matrix& c = m;
+  EXPECT_EQ(c.Data(), m[0]);
+  EXPECT_EQ(c.RowPtr(2), m[2]);
+
+  S21MatrixView block = m.Block(1, 1, 2, 2);
+  EXPECT_EQ(block.AtUnchecked(1, 0), 9);
+  EXPECT_EQ(block.RowPtr(1), m[2] + 1);
+
+#ifndef S21_MATRIX_NO_BOUNDS_CHECK
+  EXPECT_THROW(m(3, 0), std::out_of_range);
+  EXPECT_THROW(m[-1], std::out_of_range);
+#endif
+}
+
+TEST(test_access, test_iterators) {
+  S21Matrix m(3, 4);
+  std::iota(m.begin(), m.end(), 1);
+  EXPECT_EQ(m[2][3], 12);
+  EXPECT_EQ(std::accumulate(m.begin(), m.end(), 0.0), 78);
+
+  int row_count = 0;
+  for (const double* row : static_cast<const S21Matrix&>(m).Rows()) {
+    EXPECT_EQ(row[0], 4 * row_count + 1);
+    ++row_count;
+  }
+  EXPECT_EQ(row_count, 3);
+
+  auto rows = m.Block(0, 1, 3, 2).Rows();
+  EXPECT_EQ(rows.end() - rows.begin(), 3);
+  EXPECT_EQ(rows.begin()[2][1], 11);
+  EXPECT_EQ(*std::prev(rows.end()), m[2] + 1);
+
+  std::vector<double*> reversed(rows.size());
+  std::reverse_copy(rows.begin(), rows.end(), reversed.begin());
+  EXPECT_EQ(reversed[0][0], 10);
+
+  S21Matrix empty;
+  EXPECT_EQ(empty.begin(), empty.end());
+  EXPECT_EQ(empty.Rows().begin(), empty.Rows().end());
+}
+
+TEST(test_operations, test_transpose_in_place) {
+  for (int rows : {1, 4, 45, 130}) {
+    for (int cols : {1, 4, 45, 77}) {
+      S21Matrix m(rows, cols);
+      std::iota(m.begin(), m.end(), 0);
+      S21Matrix expected = m.Transpose();
+
+      m.TransposeInPlace();
+      EXPECT_EQ(m.GetRows(), cols);
+      EXPECT_EQ(m.GetCols(), rows);
+      EXPECT_TRUE(m == expected);
+    }
+  }
+
+  S21Matrix m(300, 200);
+  std::iota(m.begin(), m.end(), 0);
+  S21Matrix block = m.Block(10, 20, 150, 170).Transpose();
+  EXPECT_EQ(block.GetRows(), 170);
+  EXPECT_EQ(block[169][149], m[159][189]);
+}
+
+TEST(test_operations, test_resize_capacity) {
+  S21Matrix m(3, 4);
+  std::iota(m.begin(), m.end(), 0);
+  S21Matrix expected(m);
+  const double* data = m.Data();
+
+  m.SetRows(2);
+  m.SetCols(3);
+  EXPECT_EQ(m.Data(), data);
+  EXPECT_EQ(m.GetCapacity(), 12);
+  EXPECT_EQ(m(1, 2), expected(1, 2));
+
+  m.SetCols(4);
+  m.SetRows(3);
+  EXPECT_EQ(m.Data(), data);
+  EXPECT_EQ(m(1, 2), expected(1, 2));
+  EXPECT_EQ(m(1, 3), 0);
+  EXPECT_EQ(m(2, 0), 0);
+
+  m.SetCols(6);
+  EXPECT_EQ(m(2, 5), 0);
+  EXPECT_EQ(m(0, 3), 0);
+  EXPECT_EQ(m(1, 1), expected(1, 1));
+  m.ShrinkToFit();
+  EXPECT_EQ(m.GetCapacity(), 18);
+  EXPECT_EQ(m(1, 1), expected(1, 1));
+
+  S21Matrix rows;
+  EXPECT_THROW(rows.AppendRow(expected.Data()), std::logic_error);
+  EXPECT_THROW(rows.SetRows(2), std::invalid_argument);
+  EXPECT_THROW(rows.Reserve(0, 4), std::invalid_argument);
+  rows.Reserve(1, 4);
+  EXPECT_EQ(rows.GetRows(), 0);
+  EXPECT_EQ(rows.GetCols(), 0);
+
+  int reallocations = 0;
+  for (int i = 0; i != 1000; ++i) {
+    data = rows.Data();
+    rows.AppendRow(expected[i % 3]);
+    if (rows.Data() != data) ++reallocations;
+  }
+  EXPECT_EQ(rows.GetRows(), 1000);
+  EXPECT_LE(reallocations, 11);
+  EXPECT_EQ(rows(999, 3), expected(0, 3));
+  EXPECT_EQ(rows(500, 1), expected(2, 1));
+
+  rows = expected;
+  EXPECT_EQ(rows.GetCapacity(), 4096);
+  EXPECT_TRUE(rows == expected);
+  rows.ShrinkToFit();
+  EXPECT_EQ(rows.GetCapacity(), 12);
+}
+
+TEST(test_operations, test_reserve_empty) {
+  std::string path = testing::TempDir() + "s21_matrix_reserve.bin";
+  S21Matrix reserved;
+  reserved.Reserve(2, 3);
+  EXPECT_GE(reserved.GetCapacity(), 6);
+  EXPECT_TRUE(reserved == S21Matrix());
+
+  S21Matrix copy(reserved);
+  EXPECT_EQ(copy.GetRows(), 0);
+  EXPECT_EQ(copy.GetCols(), 0);
+
+  reserved.Save(path);
+  S21Matrix loaded = S21Matrix::Load(path);
+  EXPECT_EQ(loaded.GetRows(), 0);
+  EXPECT_EQ(loaded.GetCols(), 0);
+  std::remove(path.c_str());
+
+  S21Matrix moved(std::move(reserved));
+  double row[3] = {1, 2, 3};
+  moved.AppendRow(row);
+  EXPECT_EQ(moved.GetRows(), 1);
+  EXPECT_EQ(moved.GetCols(), 3);
+  EXPECT_EQ(moved(0, 2), 3);
+  EXPECT_THROW(reserved.AppendRow(row), std::logic_error);
+
+  copy.Reserve(1, 3);
+  copy = S21Matrix();
+  EXPECT_THROW(copy.AppendRow(row), std::logic_error);
+}
+
+TEST(test_operations, test_mulmatrix_strassen) {
+  for (int m : {1, 16, 37}) {
+    for (int k : {9, 32, 45}) {
+      for (int n : {1, 24, 51}) {
+        S21Matrix a(m, k), b(k, n);
+        for (int i = 0; i != m * k; ++i) a.Data()[i] = (i % 13) * 0.25 - 1;
+        for (int i = 0; i != k * n; ++i) b.Data()[i] = (i % 7) - 2.5;
+
+        S21Matrix expected = a * b;
+        for (int cutoff : {1, 4, STRASSEN_CUTOFF}) {
+          S21Matrix res(a);
+          res.MulMatrixStrassen(b, cutoff);
+          EXPECT_EQ(res.GetRows(), m);
+          EXPECT_EQ(res.GetCols(), n);
+          EXPECT_TRUE(res == expected);
+        }
+      }
+    }
+  }
+
+  S21Matrix a(40, 40);
+  for (int i = 0; i != 1600; ++i) a.Data()[i] = i % 11;
+  S21Matrix block(a.Block(3, 5, 20, 30));
+  S21Matrix expected = block * a.Block(1, 2, 30, 17);
+  block.MulMatrixStrassen(a.Block(1, 2, 30, 17), 3);
+  EXPECT_TRUE(block == expected);
+
+  EXPECT_THROW(block.MulMatrixStrassen(block), std::logic_error);
+  EXPECT_THROW(a.MulMatrixStrassen(a, 0), std::invalid_argument);
+}
+
+TEST(test_operations, test_gemm) {
+  S21Matrix a(37, 45), b(45, 51);
+  for (int i = 0; i != 37 * 45; ++i) a.Data()[i] = (i % 13) * 0.25 - 1;
+  for (int i = 0; i != 45 * 51; ++i) b.Data()[i] = (i % 7) - 2.5;
+  S21Matrix at = a.Transpose(), bt = b.Transpose();
+
+  S21Matrix c(37, 51);
+  std::iota(c.begin(), c.end(), 0);
+  S21Matrix expected = (a * b) * 0.5 + c * 2;
+  for (bool trans_a : {false, true}) {
+    for (bool trans_b : {false, true}) {
+      S21Matrix res(c);
+      S21Matrix::Gemm(0.5, trans_a ? at : a, trans_a, trans_b ? bt : b,
+                      trans_b, 2, res);
+      EXPECT_TRUE(res == expected);
+    }
+  }
+
+  S21Matrix big(60, 60);
+  std::iota(big.begin(), big.end(), 0);
+  S21Matrix square(a.Block(0, 0, 37, 37));
+  expected = S21Matrix(big.Block(10, 20, 37, 37)) + square * square;
+  S21Matrix::Gemm(1, square, false, square, false, 1,
+                  big.Block(10, 20, 37, 37));
+  EXPECT_TRUE(S21Matrix(big.Block(10, 20, 37, 37)) == expected);
+  EXPECT_EQ(big(9, 20), 560);
+
+  expected = square.Transpose() * square;
+  S21Matrix::Gemm(1, square, true, square, false, 0, square);
+  EXPECT_TRUE(square == expected);
+
+  EXPECT_THROW(S21Matrix::Gemm(1, a, false, b, true, 0, c), std::logic_error);
+  EXPECT_THROW(S21Matrix::Gemm(1, a, false, b, false, 0, square),
+               std::logic_error);
+
+  std::vector<double> x(45), y(37, 1), xt(37, 2), yt(45, 1);
+  std::iota(x.begin(), x.end(), 0);
+  S21Matrix::Gemv(2, a, false, x, -1, y);
+  S21Matrix::Gemv(1, a, true, xt, 0.5, yt);
+  S21Matrix product = a * S21Matrix(S21MatrixView(x.data(), 45, 1));
+  for (int i = 0; i != 37; ++i) EXPECT_DOUBLE_EQ(y[i], 2 * product(i, 0) - 1);
+  for (int j = 0; j != 45; ++j) {
+    double sum = 0;
+    for (int i = 0; i != 37; ++i) sum += 2 * a(i, j);
+    EXPECT_DOUBLE_EQ(yt[j], sum + 0.5);
+  }
+
+  std::vector<double> z(37, 1);
+  S21Matrix::Gemv(1, square, false, z, 0, z);
+  for (int i = 0; i != 37; ++i) {
+    double sum = 0;
+    for (int j = 0; j != 37; ++j) sum += square(i, j);
+    EXPECT_DOUBLE_EQ(z[i], sum);
+  }
+  EXPECT_THROW(S21Matrix::Gemv(1, a, false, xt, 0, y), std::logic_error);
+
+  S21Matrix tiny(2, 2), column(2, 1), flushed(2, 1);
+  tiny(0, 0) = 1e-4, tiny(1, 1) = 1;
+  column(0, 0) = 1e-4, column(1, 0) = 1;
+  std::vector<double> v = {1e-4, 1}, w(2, 1), wt(2, 1);
+  S21Matrix::Gemm(1, tiny, false, column, false, 0, flushed);
+  S21Matrix::Gemv(1, tiny, false, v, 0, w);
+  S21Matrix::Gemv(1, tiny, true, v, 0, wt);
+  EXPECT_EQ(flushed(0, 0), 0);
+  EXPECT_EQ(w[0], flushed(0, 0));
+  EXPECT_EQ(wt[0], flushed(0, 0));
+  EXPECT_EQ(w[1], flushed(1, 0));
+}
+
+long exported_calls = -1;
+
+void export_stats(const S21MatrixStats& stats) {
+  exported_calls = stats.ops[S21_OP_MUL_MATRIX].calls;
+}
+
+TEST(test_stats, test_stats) {
+  S21Matrix::ResetStats();
+
+  S21Matrix a(3, 4), b(4, 2);
+  a.SumMatrix(a);
+  S21Matrix c = a * b;
+  c.Transpose().Transpose().Block(0, 0, 2, 2).Determinant();
+
+  S21MatrixStats stats = S21Matrix::Stats();
+  EXPECT_STREQ(stats.ops[S21_OP_MUL_MATRIX].name, "MulMatrix");
+
+#ifdef S21_MATRIX_PROFILING
+  EXPECT_EQ(stats.ops[S21_OP_SUM].calls, 1);
+  EXPECT_EQ(stats.ops[S21_OP_SUM].flops, 12);
+  EXPECT_EQ(stats.ops[S21_OP_MUL_MATRIX].calls, 1);
+  EXPECT_EQ(stats.ops[S21_OP_MUL_MATRIX].flops, 48);
+  EXPECT_EQ(stats.ops[S21_OP_TRANSPOSE].calls, 2);
+  EXPECT_EQ(stats.ops[S21_OP_DETERMINANT].calls, 1);
+  EXPECT_EQ(stats.allocations, 5);
+  EXPECT_EQ(stats.bytes_allocated, 8 * (12 + 8 + 3 * 6));
+  EXPECT_GE(stats.peak_live_bytes, stats.live_bytes);
+#else
+  EXPECT_EQ(stats.ops[S21_OP_MUL_MATRIX].calls, 0);
+  EXPECT_EQ(stats.allocations, 0);
+#endif
+
+  S21Matrix::SetStatsExporter(export_stats);
+  S21Matrix::ExportStats();
+  EXPECT_EQ(exported_calls, stats.ops[S21_OP_MUL_MATRIX].calls);
+  S21Matrix::SetStatsExporter(nullptr);
+
+  S21Matrix::ResetStats();
+  EXPECT_EQ(S21Matrix::Stats().ops[S21_OP_SUM].calls, 0);
+  EXPECT_EQ(S21Matrix::Stats().bytes_allocated, 0);
+}
+
+TEST(test_io, test_binary_round_trip) {
+  std::string path = testing::TempDir() + "s21_matrix_round_trip.bin";
+  S21Matrix m(37, 19);
+  for (int i = 0; i != 37 * 19; ++i) m.Data()[i] = std::sin(i) * 1e-12 + i;
+
+  m.Save(path);
+  S21Matrix loaded = S21Matrix::Load(path);
+  EXPECT_EQ(loaded.GetRows(), 37);
+  EXPECT_EQ(loaded.GetCols(), 19);
+  EXPECT_TRUE(std::equal(m.begin(), m.end(), loaded.begin()));
+
+  S21Matrix mapped = S21Matrix::Map(path);
+  EXPECT_TRUE(std::equal(m.begin(), m.end(), mapped.begin()));
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(mapped.Data()) % S21_MATRIX_ALIGNMENT,
+            0u);
+
+  mapped(0, 0) = -1;
+  mapped.SumMatrix(m);
+  EXPECT_EQ(S21Matrix::Load(path)(0, 0), m(0, 0));
+
+  S21Matrix().Save(path);
+  EXPECT_EQ(S21Matrix::Load(path).GetRows(), 0);
+  EXPECT_EQ(S21Matrix::Map(path).GetCols(), 0);
+  std::remove(path.c_str());
+}
+
+TEST(test_io, test_binary_byte_order) {
+  std::string path = testing::TempDir() + "s21_matrix_byte_order.bin";
+  S21Matrix m(3, 5);
+  std::iota(m.begin(), m.end(), 0.5);
+  m.Save(path);
+
+  std::vector<char> bytes;
+  {
+    std::ifstream in(path, std::ios::binary);
+    bytes.assign(std::istreambuf_iterator<char>(in), {});
+  }
+  for (int field = 8; field != 24; field += 4) {
+    std::reverse(bytes.begin() + field, bytes.begin() + field + 4);
+  }
+  for (size_t field = 24; field != bytes.size(); field += 8) {
+    std::reverse(bytes.begin() + field, bytes.begin() + field + 8);
+  }
+  std::ofstream(path, std::ios::binary).write(bytes.data(), bytes.size());
+
+  EXPECT_TRUE(S21Matrix::Load(path) == m);
+  EXPECT_THROW(S21Matrix::Map(path), std::runtime_error);
+  std::remove(path.c_str());
+}
+
+TEST(test_io, test_binary_errors) {
+  std::string path = testing::TempDir() + "s21_matrix_errors.bin";
+  EXPECT_THROW(S21Matrix::Load(path + ".missing"), std::runtime_error);
+  EXPECT_THROW(S21Matrix::Map(path + ".missing"), std::runtime_error);
+
+  std::ofstream(path) << "1 2 3 4";
+  EXPECT_THROW(S21Matrix::Load(path), std::runtime_error);
+  EXPECT_THROW(S21Matrix::Map(path), std::runtime_error);
+
+  S21Matrix(4, 4).Save(path);
+  std::vector<char> bytes;
+  {
+    std::ifstream in(path, std::ios::binary);
+    bytes.assign(std::istreambuf_iterator<char>(in), {});
+  }
+  std::ofstream(path, std::ios::binary).write(bytes.data(), bytes.size() - 8);
+  EXPECT_THROW(S21Matrix::Load(path), std::runtime_error);
+  EXPECT_THROW(S21Matrix::Map(path), std::runtime_error);
+
+  EXPECT_THROW(S21Matrix(2, 2).Save("/nonexistent/dir/matrix.bin"),
+               std::runtime_error);
+  std::remove(path.c_str());
+}
@@ -0,0 +1,67 @@
+#include "../s21_matrix_qr.h"
+#include "gtest/gtest.h"
+
+#include <cmath>
+
+S21Matrix qr_fill(int rows, int cols) {
+  S21Matrix res(rows, cols);
+  for (int i = 0; i != rows; ++i) {
+    for (int j = 0; j != cols; ++j) {
+      res(i, j) = std::sin((i + 1) * (j + 2) * 0.37);
+    }
+  }
+  return res;
+}
+
+TEST(test_qr, test_factor) {
+  S21Matrix a(3);
+  a(0, 0) = 12, a(0, 1) = -51, a(0, 2) = 4;
+  a(1, 0) = 6, a(1, 1) = 167, a(1, 2) = -68;
+  a(2, 0) = -4, a(2, 1) = 24, a(2, 2) = -41;
+  S21MatrixQr qr = a.Qr();
+  S21Matrix r = qr.R();
+
+  EXPECT_TRUE(qr.IsFullRank());
+  EXPECT_NEAR(std::fabs(r(0, 0)), 14, 1e-9);
+  EXPECT_NEAR(std::fabs(r(1, 1)), 175, 1e-9);
+  EXPECT_NEAR(std::fabs(r(2, 2)), 35, 1e-9);
+  EXPECT_EQ(r(2, 0), 0);
+  EXPECT_TRUE(qr.Q() * r == a);
+
+  std::vector<double> x = qr.Solve(std::vector<double>{16, -62, -45});
+  EXPECT_NEAR(x[0], 1, 1e-9);
+  EXPECT_NEAR(x[1], 0, 1e-9);
+  EXPECT_NEAR(x[2], 1, 1e-9);
+
+  EXPECT_THROW(qr.Solve(std::vector<double>{1, 2}), std::logic_error);
+  EXPECT_THROW(S21Matrix(2, 3).Qr(), std::logic_error);
+
+  a(2, 0) = a(0, 0) + a(1, 0);
+  a(2, 1) = a(0, 1) + a(1, 1);
+  a(2, 2) = a(0, 2) + a(1, 2);
+  EXPECT_FALSE(a.Qr().IsFullRank());
+  EXPECT_THROW(a.Qr().Solve(std::vector<double>(3, 1)), std::logic_error);
+}
+
+TEST(test_qr, test_least_squares) {
+  for (int cols : {1, 31, 32, 33, 70}) {
+    int rows = 2 * cols + 5;
+    S21Matrix a = qr_fill(rows, cols);
+    S21MatrixQr qr = a.Qr();
+
+    S21Matrix q = qr.Q();
+    S21Matrix gram = q.Transpose() * q;
+    for (int i = 0; i != cols; ++i) {
+      for (int j = 0; j != cols; ++j) EXPECT_NEAR(gram(i, j), i == j, 1e-12);
+    }
+    S21Matrix product = q * qr.R() - a;
+    for (double value : product) EXPECT_NEAR(value, 0, 1e-12);
+
+    S21Matrix source = qr_fill(rows + 3, 4);
+    S21Matrix b(source.Block(3, 0, rows, 4));
+    S21Matrix x = qr.Solve(b);
+    EXPECT_EQ(x.GetRows(), cols);
+    S21Matrix normal = a.Transpose() * (a * x - b);
+    for (double value : normal) EXPECT_NEAR(value, 0, 1e-9);
+  }
+}
@@ -0,0 +1,175 @@
+#include "../s21_matrix_text.h"
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <sstream>
+
+TEST(test_text, test_round_trip) {
+  S21Matrix m(4, 3);
+  for (int i = 0; i != 12; ++i) m.Data()[i] = std::sin(i) * std::pow(10, i - 6);
+  m(1, 1) = -0.0;
+  m(2, 2) = 1e300;
+
+  for (S21TextDialect dialect : {S21_TEXT_WHITESPACE, S21_TEXT_CSV}) {
+    for (bool header : {false, true}) {
+      std::stringstream text;
+      S21MatrixWriter(text, dialect).WriteMatrix(m, header);
+
+      S21MatrixReader reader(text, dialect, header);
+      EXPECT_EQ(reader.HasHeader(), header);
+      S21Matrix res = reader.ReadMatrix();
+      EXPECT_EQ(res.GetRows(), 4);
+      EXPECT_EQ(res.GetCols(), 3);
+      for (int i = 0; i != 12; ++i) EXPECT_EQ(res.Data()[i], m.Data()[i]);
+    }
+  }
+
+  std::stringstream csv;
+  S21MatrixWriter(csv, S21_TEXT_CSV).WriteMatrix(m.Block(0, 0, 1, 2));
+  EXPECT_EQ(csv.str(), "0,8.414709848078966e-06\n");
+}
+
+TEST(test_text, test_dialects) {
+  std::istringstream spaces("\n 1\t2.5   -3e2 \r\n\n+4 0x 1\n");
+  S21MatrixReader reader(spaces);
+  std::vector<double> row;
+
+  ASSERT_TRUE(reader.ReadRow(row));
+  EXPECT_EQ(row, (std::vector<double>{1, 2.5, -300}));
+  EXPECT_EQ(reader.GetLine(), 2);
+  try {
+    reader.ReadRow(row);
+    FAIL();
+  } catch (const S21MatrixParseError& e) {
+    EXPECT_EQ(e.GetLine(), 4);
+    EXPECT_EQ(e.GetColumn(), 5);
+  }
+
+  std::istringstream csv("1, 2 ,3\n4,5,6\n");
+  S21Matrix m = S21MatrixReader(csv, S21_TEXT_CSV).ReadMatrix();
+  EXPECT_EQ(m.GetRows(), 2);
+  EXPECT_EQ(m(1, 2), 6);
+
+  std::istringstream missing("1,,3\n");
+  EXPECT_THROW(S21MatrixReader(missing, S21_TEXT_CSV).ReadMatrix(),
+               S21MatrixParseError);
+  std::istringstream trailing("1,2,\n");
+  EXPECT_THROW(S21MatrixReader(trailing, S21_TEXT_CSV).ReadMatrix(),
+               S21MatrixParseError);
+  std::istringstream spaced("1 2\n");
+  EXPECT_THROW(S21MatrixReader(spaced, S21_TEXT_CSV).ReadMatrix(),
+               S21MatrixParseError);
+  std::istringstream huge("1e999\n");
+  EXPECT_THROW(S21MatrixReader(huge).ReadMatrix(), S21MatrixParseError);
+}
+
+TEST(test_text, test_header) {
+  std::istringstream with_header("2 3\n1 2 3\n4 5 6\n");
+  S21MatrixReader reader(with_header, S21_TEXT_WHITESPACE, true);
+  EXPECT_TRUE(reader.HasHeader());
+  EXPECT_EQ(reader.ReadMatrix()(1, 0), 4);
+
+  std::istringstream square("1 2\n3 4\n");
+  S21MatrixReader plain(square);
+  EXPECT_FALSE(plain.HasHeader());
+  S21Matrix m = plain.ReadMatrix();
+  EXPECT_EQ(m.GetRows(), 2);
+  EXPECT_EQ(m.GetCols(), 2);
+  EXPECT_EQ(m(0, 0), 1);
+  EXPECT_EQ(m(1, 1), 4);
+
+  std::istringstream sizes_like("2 2\n3 4\n5 6\n");
+  m = S21MatrixReader(sizes_like).ReadMatrix();
+  EXPECT_EQ(m.GetRows(), 3);
+  EXPECT_EQ(m(0, 0), 2);
+  EXPECT_EQ(m(2, 1), 6);
+
+  std::istringstream short_data("3 2\n1 2\n");
+  EXPECT_THROW(S21MatrixReader(short_data, S21_TEXT_WHITESPACE, true)
+                   .ReadMatrix(),
+               S21MatrixParseError);
+  std::istringstream bad_header("2.5 2\n1 2\n");
+  EXPECT_THROW(S21MatrixReader(bad_header, S21_TEXT_WHITESPACE, true)
+                   .ReadMatrix(),
+               S21MatrixParseError);
+  std::istringstream wide_header("1,2,3\n1,2\n");
+  EXPECT_THROW(S21MatrixReader(wide_header, S21_TEXT_CSV, true).ReadMatrix(),
+               S21MatrixParseError);
+  std::istringstream no_header("");
+  EXPECT_THROW(S21MatrixReader(no_header, S21_TEXT_WHITESPACE, true)
+                   .ReadMatrix(),
+               S21MatrixParseError);
+
+  std::istringstream ragged("1 2 3\n4 5\n");
+  try {
+    S21MatrixReader(ragged).ReadMatrix();
+    FAIL();
+  } catch (const S21MatrixParseError& e) {
+    EXPECT_EQ(e.GetLine(), 2);
+  }
+
+  std::istringstream empty("0 0\n");
+  EXPECT_EQ(S21MatrixReader(empty, S21_TEXT_WHITESPACE, true)
+                .ReadMatrix()
+                .GetRows(),
+            0);
+
+  std::istringstream oversized("2000000000 3\n1 2 3\n");
+  EXPECT_THROW(S21MatrixReader(oversized, S21_TEXT_WHITESPACE, true)
+                   .ReadMatrix(),
+               S21MatrixParseError);
+}
+
+TEST(test_text, test_streaming_rows) {
+  std::stringstream text;
+  {
+    S21MatrixWriter writer(text);
+    writer.WriteHeader(5000, 3);
+    for (int i = 0; i != 5000; ++i) {
+      double row[] = {i * 0.1, -i * 1e-7, 1.0 / (i + 1)};
+      writer.WriteRow(row, 3);
+    }
+  }
+
+  S21MatrixReader reader(text, S21_TEXT_WHITESPACE, true);
+  std::vector<double> row;
+  int count = 0;
+  while (reader.ReadRow(row)) {
+    ASSERT_EQ(row.size(), 3u);
+    EXPECT_EQ(row[2], 1.0 / (count + 1));
+    ++count;
+  }
+  EXPECT_EQ(count, 5000);
+}
+
+TEST(test_text, test_stream_operators) {
+  S21Matrix m(2, 2);
+  m(0, 0) = 0.1;
+  m(0, 1) = 1.0 / 3;
+  m(1, 1) = -2e-300;
+
+  std::stringstream text;
+  text << m;
+  EXPECT_EQ(text.str(), "0.1 0.3333333333333333 \n0 -2e-300 \n");
+
+  S21Matrix res(2, 2);
+  text >> res;
+  EXPECT_TRUE(std::equal(m.begin(), m.end(), res.begin()));
+
+  std::istringstream bad("1 x 3 4");
+  S21Matrix partial(2, 2);
+  bad >> partial;
+  EXPECT_TRUE(bad.fail());
+  EXPECT_EQ(partial(0, 0), 1);
+  EXPECT_EQ(partial(1, 1), 0);
+
+  std::istringstream strict("1 2 3");
+  strict.exceptions(std::ios::failbit);
+  EXPECT_THROW(strict >> partial, std::ios::failure);
+
+  struct RejectingBuffer : std::streambuf {
+  } rejecting;
+  std::ostream closed(&rejecting);
+  closed.exceptions(std::ios::badbit);
+  EXPECT_THROW(closed << m, std::ios::failure);
+}
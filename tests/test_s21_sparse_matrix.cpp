@@ -0,0 +1,127 @@
+#include "../s21_sparse_matrix.h"
+#include "gtest/gtest.h"
+
+#include <cmath>
+
+S21Matrix sparse_fill(int rows, int cols, int every) {
+  S21Matrix res(rows, cols);
+  for (int i = 0; i != rows; ++i) {
+    for (int j = 0; j != cols; ++j) {
+      if ((i * cols + j) % every == 0) res(i, j) = std::sin(i + 2.0 * j) + 1.5;
+    }
+  }
+  return res;
+}
+
+TEST(test_sparse, test_builder) {
+  S21SparseMatrix::Builder builder(3, 4);
+  builder.Add(2, 1, 5);
+  builder.Add(0, 3, 1);
+  builder.Add(2, 1, -2);
+  builder.Add(1, 0, 4);
+  builder.Add(1, 0, -4);
+  S21SparseMatrix sparse = builder.Build();
+
+  EXPECT_EQ(sparse.GetRows(), 3);
+  EXPECT_EQ(sparse.GetCols(), 4);
+  EXPECT_EQ(sparse.GetNonZeros(), 2);
+  EXPECT_DOUBLE_EQ(sparse(2, 1), 3);
+  EXPECT_DOUBLE_EQ(sparse(0, 3), 1);
+  EXPECT_DOUBLE_EQ(sparse(1, 0), 0);
+  EXPECT_EQ(sparse.RowOffsets()[3], 2);
+
+  EXPECT_THROW(builder.Add(3, 0, 1), std::out_of_range);
+  EXPECT_THROW(builder.Add(0, -1, 1), std::out_of_range);
+  EXPECT_THROW(sparse(0, 4), std::out_of_range);
+  EXPECT_THROW(S21SparseMatrix::Builder(0, 1), std::invalid_argument);
+  EXPECT_THROW(S21SparseMatrix(1, 0), std::invalid_argument);
+}
+
+TEST(test_sparse, test_dense_conversion) {
+  S21Matrix dense = sparse_fill(7, 9, 4);
+  S21SparseMatrix sparse(dense);
+
+  EXPECT_EQ(sparse.ToDense(), dense);
+  EXPECT_EQ(sparse.GetNonZeros(), 16);
+  EXPECT_EQ(S21SparseMatrix(dense.Block(1, 2, 3, 4)).ToDense(),
+            S21Matrix(dense.Block(1, 2, 3, 4)));
+
+  S21Matrix small(2, 2);
+  small(0, 0) = 1e-9;
+  small(1, 1) = 2;
+  EXPECT_EQ(S21SparseMatrix(small).GetNonZeros(), 2);
+  EXPECT_EQ(S21SparseMatrix(small, PRECISION).GetNonZeros(), 1);
+  EXPECT_EQ(S21SparseMatrix().ToDense().GetRows(), 0);
+
+  small(0, 0) = NAN;
+  S21SparseMatrix with_nan(small, PRECISION);
+  EXPECT_EQ(with_nan.GetNonZeros(), 2);
+  EXPECT_TRUE(std::isnan(with_nan.ToDense()(0, 0)));
+}
+
+TEST(test_sparse, test_spmv) {
+  S21Matrix dense = sparse_fill(301, 157, 5);
+  S21SparseMatrix sparse(dense);
+  std::vector<double> x(157);
+  S21Matrix column(157, 1);
+  for (int i = 0; i != 157; ++i) x[i] = column(i, 0) = std::cos(i);
+
+  std::vector<double> y = sparse * x;
+  S21Matrix expected = dense * column;
+  ASSERT_EQ(y.size(), 301u);
+  for (int i = 0; i != 301; ++i) EXPECT_NEAR(y[i], expected(i, 0), 1e-9);
+
+  EXPECT_THROW(sparse * std::vector<double>(156), std::logic_error);
+}
+
+TEST(test_sparse, test_spmm) {
+  S21Matrix dense = sparse_fill(64, 48, 3);
+  S21SparseMatrix sparse(dense);
+  S21Matrix right = sparse_fill(48, 33, 1);
+  S21Matrix left = sparse_fill(29, 64, 1);
+
+  EXPECT_EQ(sparse * right, dense * right);
+  EXPECT_EQ(left * sparse, left * dense);
+  EXPECT_EQ(sparse * right.Block(0, 5, 48, 20),
+            dense * S21Matrix(right.Block(0, 5, 48, 20)));
+
+  EXPECT_THROW(sparse * left, std::logic_error);
+  EXPECT_THROW(right * sparse, std::logic_error);
+}
+
+TEST(test_sparse, test_sum_sub) {
+  S21Matrix a = sparse_fill(20, 30, 3);
+  S21Matrix b = sparse_fill(20, 30, 7);
+  S21SparseMatrix sa(a), sb(b);
+
+  EXPECT_EQ((sa + sb).ToDense(), a + b);
+  EXPECT_EQ((sa - sb).ToDense(), a - b);
+  EXPECT_EQ((sa - sa).GetNonZeros(), 0);
+  EXPECT_EQ((sa * 2.5).ToDense(), a * 2.5);
+  EXPECT_EQ((sa * 0.0).GetNonZeros(), 0);
+  EXPECT_EQ((sa * 1e-9).GetNonZeros(), 0);
+  EXPECT_EQ((sa * 0.0).RowOffsets()[20], 0);
+
+  S21Matrix mixed(2, 2);
+  mixed(0, 1) = 1e-4;
+  mixed(1, 0) = 5;
+  mixed(1, 1) = 1e-5;
+  S21SparseMatrix scaled = S21SparseMatrix(mixed) * 1e-4;
+  EXPECT_EQ(scaled.GetNonZeros(), 1);
+  EXPECT_EQ(scaled.RowOffsets()[1], 0);
+  EXPECT_DOUBLE_EQ(scaled(1, 0), 5e-4);
+  EXPECT_TRUE(sa == S21SparseMatrix(a));
+  EXPECT_FALSE(sa == sb);
+  EXPECT_THROW(sa + S21SparseMatrix(30, 20), std::logic_error);
+  EXPECT_THROW(sa - S21SparseMatrix(20, 31), std::logic_error);
+}
+
+TEST(test_sparse, test_transpose) {
+  S21Matrix dense = sparse_fill(13, 21, 4);
+  S21SparseMatrix transposed = S21SparseMatrix(dense).Transpose();
+
+  EXPECT_EQ(transposed.GetRows(), 21);
+  EXPECT_EQ(transposed.GetCols(), 13);
+  EXPECT_EQ(transposed.ToDense(), dense.Transpose());
+  EXPECT_EQ(transposed.Transpose(), S21SparseMatrix(dense));
+}